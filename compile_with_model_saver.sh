@@ -20,7 +20,12 @@ gcc -O3 -march=native -o neuroplast-ann \
     src/config.c \
     src/math_utils.c \
     src/matrix.c \
+    src/gemm.c \
     src/memory.c \
+    src/thread_pool.c \
+    src/sweep_executor.c \
+    src/sweep_journal.c \
+    src/rng.c \
     src/yaml_parser_rich.c \
     src/csv_export_complete.c \
     src/yaml/lexer.c \
@@ -30,12 +35,14 @@ gcc -O3 -march=native -o neuroplast-ann \
     src/data/image_loader.c \
     src/data/dataset.c \
     src/data/dataset_analyzer.c \
+    src/data/dataset_cache.c \
     src/data/preprocessing.c \
     src/data/split.c \
     src/neural/activation.c \
     src/neural/backward.c \
     src/neural/forward.c \
     src/neural/layer.c \
+    src/neural/param_arena.c \
     src/neural/network.c \
     src/neural/network_simple.c \
     src/neural/neuroplast.c \
@@ -48,6 +55,7 @@ gcc -O3 -march=native -o neuroplast-ann \
     src/optimizers/radam.c \
     src/optimizers/adamax.c \
     src/optimizers/nadam.c \
+    src/optimizers/fused_update.c \
     src/optimizers/optimizer.c \
     src/training/trainer.c \
     src/training/standard.c \
@@ -57,16 +65,18 @@ gcc -O3 -march=native -o neuroplast-ann \
     src/training/progressive.c \
     src/training/swarm.c \
     src/training/propagation.c \
+    src/training/health_monitor.c \
     src/evaluation/metrics.c \
     src/evaluation/confusion_matrix.c \
     src/evaluation/f1_score.c \
     src/evaluation/roc.c \
+    src/evaluation/metrics_engine.c \
     src/model_saver/model_saver.c \
     src/model_saver/model_saver_core.c \
     src/model_saver/model_saver_pth.c \
     src/model_saver/model_saver_h5.c \
     src/model_saver/model_saver_utils.c \
-    -lm -I./src
+    -lm -pthread -I./src
 
 if [ $? -eq 0 ]; then
     echo "✅ Compilation réussie!"
@@ -1,4 +1,5 @@
 #include "dataset_analyzer.h"
+#include "dataset_cache.h"
 #include "../colored_output.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -230,7 +231,7 @@ bool analyze_dataset_fields(const RichConfig *config, DatasetAnalyzer *analyzer)
 // TRAITEMENT DU DATASET TABULAIRE
 // ============================================================================
 
-bool process_tabular_dataset(const RichConfig *config, const DatasetAnalyzer *analyzer, Dataset **dataset) {
+bool process_tabular_dataset(const RichConfig *config, DatasetAnalyzer *analyzer, Dataset **dataset) {
     if (!config || !analyzer || !dataset || !analyzer->is_analyzed) return false;
     
     printf("🔄 Traitement du dataset tabulaire avec analyse automatique\n");
@@ -304,6 +305,7 @@ bool process_tabular_dataset(const RichConfig *config, const DatasetAnalyzer *an
     fclose(file);
     
     (*dataset)->num_samples = sample_idx;
+    analyzer->num_samples = sample_idx;
     printf("✅ %zu échantillons chargés\n", sample_idx);
     
     // Analyser et normaliser chaque champ d'entrée
@@ -316,11 +318,16 @@ bool process_tabular_dataset(const RichConfig *config, const DatasetAnalyzer *an
         }
         
         // Détecter le type et calculer les statistiques
-        FieldType field_type;
+        FieldType field_type = FIELD_NUMERIC;
         detect_field_type_simple(field_values, sample_idx, &field_type);
         
-        float min_val, max_val, mean_val, std_val;
+        float min_val = 0.0f, max_val = 0.0f, mean_val = 0.0f, std_val = 0.0f;
         calculate_stats(field_values, sample_idx, &min_val, &max_val, &mean_val, &std_val);
+        analyzer->input_types[i] = field_type;
+        analyzer->input_min[i] = min_val;
+        analyzer->input_max[i] = max_val;
+        analyzer->input_mean[i] = mean_val;
+        analyzer->input_std[i] = std_val;
         
         printf("   📋 %s: ", analyzer->input_fields[i]);
         
@@ -359,8 +366,13 @@ bool process_tabular_dataset(const RichConfig *config, const DatasetAnalyzer *an
     for (int i = 0; i < analyzer->num_output_fields; i++) {
         printf("   🎯 %s: classification binaire\n", analyzer->output_fields[i]);
         
+        analyzer->output_types[i] = FIELD_BINARY;
+        analyzer->output_min[i] = sample_idx > 0 ? raw_outputs[0][i] : 0.0f;
+        analyzer->output_max[i] = analyzer->output_min[i];
         for (size_t j = 0; j < sample_idx; j++) {
             (*dataset)->outputs[j][i] = raw_outputs[j][i];
+            if (raw_outputs[j][i] < analyzer->output_min[i]) analyzer->output_min[i] = raw_outputs[j][i];
+            if (raw_outputs[j][i] > analyzer->output_max[i]) analyzer->output_max[i] = raw_outputs[j][i];
         }
     }
     
@@ -400,10 +412,21 @@ Dataset* create_analyzed_dataset(const RichConfig *config) {
         return NULL;
     }
     
+    // Cache binaire du dataset traité : clé = contenu du CSV + réglages de l'analyse
+    char cache_path[512];
+    uint64_t cache_key = 0;
+    bool use_cache = config->dataset_cache && dataset_cache_key(config, &analyzer, &cache_key);
+    if (use_cache) {
+        dataset_cache_path(config->dataset, cache_path, sizeof(cache_path));
+        Dataset *cached = dataset_cache_load(cache_path, cache_key, &analyzer);
+        if (cached) return cached;
+    }
+    
     // Traiter le dataset tabulaire
     Dataset *dataset = NULL;
     if (process_tabular_dataset(config, &analyzer, &dataset)) {
         printf("✅ Dataset tabulaire traité avec succès\n");
+        if (use_cache) dataset_cache_save(cache_path, cache_key, &analyzer, dataset);
         return dataset;
     }
     
@@ -41,7 +41,8 @@ typedef struct {
 
 // Fonctions principales
 bool analyze_dataset_fields(const RichConfig *config, DatasetAnalyzer *analyzer);
-bool process_tabular_dataset(const RichConfig *config, const DatasetAnalyzer *analyzer, Dataset **dataset);
+// Remplit aussi les types et statistiques des champs de analyzer (repris par le cache)
+bool process_tabular_dataset(const RichConfig *config, DatasetAnalyzer *analyzer, Dataset **dataset);
 bool parse_field_list(const char *field_string, char fields[][MAX_FIELD_NAME], int *num_fields);
 
 // Fonctions utilitaires
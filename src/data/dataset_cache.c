@@ -0,0 +1,160 @@
+#include "dataset_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../hash.h"
+
+// Fichier entier projeté en lecture seule ; NULL si vide ou illisible
+static const unsigned char *map_file(const char *path, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return NULL;
+    *size = (size_t)st.st_size;
+    return data;
+}
+
+bool dataset_cache_key(const RichConfig *config, const DatasetAnalyzer *analyzer, uint64_t *key) {
+    size_t size = 0;
+    const unsigned char *csv = map_file(config->dataset, &size);
+    if (!csv) return false;
+
+    uint64_t h = hash_fnv1a(0, csv, size);
+    munmap((void *)csv, size);
+
+    // Réglages de l'analyse : un autre choix de champs donne un autre dataset
+    int version = DATASET_CACHE_VERSION;
+    h = hash_fnv1a(h, &version, sizeof(version));
+    for (int i = 0; i < analyzer->num_input_fields; i++)
+        h = hash_fnv1a(h, analyzer->input_fields[i], strlen(analyzer->input_fields[i]) + 1);
+    h = hash_fnv1a(h, "|", 1);
+    for (int i = 0; i < analyzer->num_output_fields; i++)
+        h = hash_fnv1a(h, analyzer->output_fields[i], strlen(analyzer->output_fields[i]) + 1);
+    h = hash_fnv1a(h, &config->auto_normalize, sizeof(config->auto_normalize));
+    h = hash_fnv1a(h, &config->auto_categorize, sizeof(config->auto_categorize));
+    h = hash_fnv1a(h, config->field_detection, strlen(config->field_detection));
+    *key = h;
+    return true;
+}
+
+void dataset_cache_path(const char *dataset_path, char *path, size_t size) {
+    snprintf(path, size, "%s%s", dataset_path, DATASET_CACHE_SUFFIX);
+}
+
+static size_t cache_fields_size(size_t in, size_t out) {
+    return in * (sizeof(int32_t) + 4 * sizeof(float)) + out * (sizeof(int32_t) + 2 * sizeof(float));
+}
+
+Dataset *dataset_cache_load(const char *path, uint64_t key, DatasetAnalyzer *analyzer) {
+    size_t size = 0;
+    const unsigned char *data = map_file(path, &size);
+    if (!data) return NULL;
+
+    const DatasetCacheHeader *header = (const DatasetCacheHeader *)data;
+    size_t in = analyzer->num_input_fields, out = analyzer->num_output_fields;
+    if (size < sizeof(*header) ||
+        memcmp(header->magic, DATASET_CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != DATASET_CACHE_VERSION || header->header_size != sizeof(*header) ||
+        header->key != key || header->input_cols != in || header->output_cols != out ||
+        header->num_samples == 0) {
+        printf("♻️ Cache du dataset périmé: %s\n", path);
+        munmap((void *)data, size);
+        return NULL;
+    }
+    size_t n = (size_t)header->num_samples;
+    size_t fixed = sizeof(*header) + cache_fields_size(in, out);
+    if (size < fixed || n > size || size - fixed != n * (in + out) * sizeof(float)) {
+        printf("♻️ Cache du dataset tronqué: %s\n", path);
+        munmap((void *)data, size);
+        return NULL;
+    }
+
+    Dataset *dataset = dataset_create(n, in, out);
+    if (!dataset) {
+        printf("Erreur: allocation du dataset depuis le cache %s\n", path);
+        munmap((void *)data, size);
+        return NULL;
+    }
+
+    const unsigned char *p = data + sizeof(*header);
+    for (size_t i = 0; i < in; i++) analyzer->input_types[i] = (FieldType)((const int32_t *)p)[i];
+    p += in * sizeof(int32_t);
+    memcpy(analyzer->input_min, p, in * sizeof(float));  p += in * sizeof(float);
+    memcpy(analyzer->input_max, p, in * sizeof(float));  p += in * sizeof(float);
+    memcpy(analyzer->input_mean, p, in * sizeof(float)); p += in * sizeof(float);
+    memcpy(analyzer->input_std, p, in * sizeof(float));  p += in * sizeof(float);
+    for (size_t i = 0; i < out; i++) analyzer->output_types[i] = (FieldType)((const int32_t *)p)[i];
+    p += out * sizeof(int32_t);
+    memcpy(analyzer->output_min, p, out * sizeof(float)); p += out * sizeof(float);
+    memcpy(analyzer->output_max, p, out * sizeof(float)); p += out * sizeof(float);
+
+    // Lignes contiguës dans le cache, recopiées dans les lignes possédées par le dataset
+    for (size_t j = 0; j < n; j++) memcpy(dataset->inputs[j], p + j * in * sizeof(float), in * sizeof(float));
+    p += n * in * sizeof(float);
+    for (size_t j = 0; j < n; j++) memcpy(dataset->outputs[j], p + j * out * sizeof(float), out * sizeof(float));
+    munmap((void *)data, size);
+
+    dataset->num_samples = n;
+    analyzer->num_samples = n;
+    printf("⚡ Dataset chargé depuis le cache: %s (%zu échantillons)\n", path, n);
+    return dataset;
+}
+
+bool dataset_cache_save(const char *path, uint64_t key, const DatasetAnalyzer *analyzer,
+                        const Dataset *dataset) {
+    size_t in = dataset->input_cols, out = dataset->output_cols;
+    char tmp_path[512];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%d", path, (int)getpid());
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        printf("⚠️ Cache du dataset non écrit (répertoire en lecture seule ?): %s\n", path);
+        return false;
+    }
+
+    DatasetCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DATASET_CACHE_MAGIC, sizeof(header.magic));
+    header.version = DATASET_CACHE_VERSION;
+    header.header_size = sizeof(header);
+    header.key = key;
+    header.num_samples = dataset->num_samples;
+    header.input_cols = (uint32_t)in;
+    header.output_cols = (uint32_t)out;
+
+    int32_t input_types[MAX_FIELDS], output_types[MAX_FIELDS];
+    for (size_t i = 0; i < in; i++) input_types[i] = analyzer->input_types[i];
+    for (size_t i = 0; i < out; i++) output_types[i] = analyzer->output_types[i];
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(input_types, sizeof(int32_t), in, file) == in &&
+              fwrite(analyzer->input_min, sizeof(float), in, file) == in &&
+              fwrite(analyzer->input_max, sizeof(float), in, file) == in &&
+              fwrite(analyzer->input_mean, sizeof(float), in, file) == in &&
+              fwrite(analyzer->input_std, sizeof(float), in, file) == in &&
+              fwrite(output_types, sizeof(int32_t), out, file) == out &&
+              fwrite(analyzer->output_min, sizeof(float), out, file) == out &&
+              fwrite(analyzer->output_max, sizeof(float), out, file) == out;
+    for (size_t j = 0; ok && j < dataset->num_samples; j++)
+        ok = fwrite(dataset->inputs[j], sizeof(float), in, file) == in;
+    for (size_t j = 0; ok && j < dataset->num_samples; j++)
+        ok = fwrite(dataset->outputs[j], sizeof(float), out, file) == out;
+    if (fclose(file) != 0) ok = false;
+
+    if (!ok || rename(tmp_path, path) != 0) {
+        printf("⚠️ Écriture du cache du dataset impossible: %s\n", path);
+        remove(tmp_path);
+        return false;
+    }
+    printf("💾 Cache du dataset écrit: %s\n", path);
+    return true;
+}
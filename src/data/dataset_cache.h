@@ -0,0 +1,52 @@
+#ifndef DATASET_CACHE_H
+#define DATASET_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "dataset.h"
+#include "dataset_analyzer.h"
+#include "../rich_config.h"
+
+// ============================================================================
+// CACHE BINAIRE DES DATASETS TABULAIRES ANALYSÉS
+// ============================================================================
+// Le dataset déjà traité (features normalisées, cibles, types de champs,
+// statistiques) est écrit à côté du CSV (<csv>.npcache) et relu d'un seul mmap
+// aux lancements suivants. Clé : hash FNV-1a du contenu du CSV et des réglages
+// de l'analyse (champs, auto_normalize, auto_categorize, field_detection).
+// Une clé, une version ou une taille différente invalide le cache, qui est
+// alors réécrit. Disposition (entiers et flottants natifs, alignés sur 4 octets) :
+//     en-tête DatasetCacheHeader
+//     int32 input_types[in]  float input_min[in] input_max[in] input_mean[in] input_std[in]
+//     int32 output_types[out]  float output_min[out] output_max[out]
+//     float inputs[n][in]  float outputs[n][out]
+
+#define DATASET_CACHE_MAGIC "NPDSCACH"
+#define DATASET_CACHE_VERSION 1
+#define DATASET_CACHE_SUFFIX ".npcache"
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;       // sizeof(DatasetCacheHeader) à l'écriture
+    uint64_t key;
+    uint64_t num_samples;
+    uint32_t input_cols;
+    uint32_t output_cols;
+} DatasetCacheHeader;
+
+// Clé du cache pour ce CSV et cette analyse. Retourne false si le CSV est illisible.
+bool dataset_cache_key(const RichConfig *config, const DatasetAnalyzer *analyzer, uint64_t *key);
+
+// Chemin du cache associé au CSV
+void dataset_cache_path(const char *dataset_path, char *path, size_t size);
+
+// Dataset du cache si la clé correspond (statistiques recopiées dans analyzer), sinon NULL
+Dataset *dataset_cache_load(const char *path, uint64_t key, DatasetAnalyzer *analyzer);
+
+// Écrire le cache (fichier temporaire puis renommage : jamais de cache à moitié écrit)
+bool dataset_cache_save(const char *path, uint64_t key, const DatasetAnalyzer *analyzer,
+                        const Dataset *dataset);
+
+#endif /* DATASET_CACHE_H */
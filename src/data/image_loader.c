@@ -26,12 +26,11 @@ bool is_image_file(const char *filename) {
 }
 
 // Fonction utilitaire pour mélanger un ImageSet (Fisher-Yates shuffle)
-void shuffle_image_set(ImageSet *set) {
+void shuffle_image_set(ImageSet *set, Rng *rng) {
     if (!set || set->count <= 1) return;
     
-    srand(time(NULL));
     for (size_t i = set->count - 1; i > 0; i--) {
-        size_t j = rand() % (i + 1);
+        size_t j = rng_below(rng, i + 1);
         
         // Échanger les éléments i et j
         ImageInfo temp = set->images[i];
@@ -256,8 +255,10 @@ Dataset *convert_image_set_to_dataset(const ImageSet *set, int width, int height
         shuffled_set->images[i] = set->images[i];
     }
     
-    // Mélanger les données
-    shuffle_image_set(shuffled_set);
+    // Mélanger les données (graine tirée de srand() : reproductible avec une graine fixe)
+    Rng rng;
+    rng_seed(&rng, rng_seed_from_rand());
+    shuffle_image_set(shuffled_set, &rng);
     printf("✅ Dataset mélangé pour améliorer l'apprentissage\n");
 
     char progress_msg[256];
@@ -10,6 +10,7 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include "dataset.h"
+#include "../rng.h"
 #include "../rich_config.h"
 
 // Structure pour stocker les informations d'une image
@@ -46,7 +47,7 @@ ImageSet *create_image_set(size_t initial_capacity);
 void free_image_set(ImageSet *set);
 bool add_image_to_set(ImageSet *set, const char *filepath, int label, const char *class_name);
 ImageSet *load_image_set(const char *directory_path);
-void shuffle_image_set(ImageSet *set);
+void shuffle_image_set(ImageSet *set, Rng *rng);
 Dataset *convert_image_set_to_dataset(const ImageSet *set, int width, int height, int channels, size_t num_classes);
 float *load_image_data(const char *filepath, int width, int height, int channels);
 void resize_image_nearest(const unsigned char *input, int input_width, int input_height, 
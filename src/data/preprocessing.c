@@ -1,6 +1,5 @@
 #include "preprocessing.h"
 #include <stdlib.h>
-#include <time.h>
 
 void normalize_dataset(Dataset *d, float new_min, float new_max) {
     for (size_t col = 0; col < d->input_cols; ++col) {
@@ -16,10 +15,9 @@ void normalize_dataset(Dataset *d, float new_min, float new_max) {
     }
 }
 
-void shuffle_dataset(Dataset *d) {
-    srand((unsigned int)time(NULL));
+void shuffle_dataset(Dataset *d, Rng *rng) {
     for (size_t i = d->num_samples - 1; i > 0; --i) {
-        size_t j = rand() % (i + 1);
+        size_t j = rng_below(rng, i + 1);
         float *tmp_in = d->inputs[i]; d->inputs[i] = d->inputs[j]; d->inputs[j] = tmp_in;
         float *tmp_out = d->outputs[i]; d->outputs[i] = d->outputs[j]; d->outputs[j] = tmp_out;
     }
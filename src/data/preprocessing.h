@@ -2,8 +2,9 @@
 #define PREPROCESSING_H
 
 #include "dataset.h"
+#include "../rng.h"
 
 void normalize_dataset(Dataset *d, float new_min, float new_max);
-void shuffle_dataset(Dataset *d);
+void shuffle_dataset(Dataset *d, Rng *rng);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "metrics_engine.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Tri par base des clés 32 bits : 3 passes (11, 11, 10 bits)
+#define RADIX_BITS 11
+#define RADIX_BUCKETS (1u << RADIX_BITS)
+#define RADIX_PASSES 3
+
+// Fin de chaque classe dans les clés triées : au-delà de toute clé de score fini
+#define KEY_SENTINEL UINT32_MAX
+
+void metrics_workspace_init(MetricsWorkspace *ws) {
+    memset(ws, 0, sizeof(*ws));
+}
+
+// Un seul bloc : clés, tampon de tri, scores et labels
+int metrics_workspace_reserve(MetricsWorkspace *ws, size_t n) {
+    if (!ws) return 0;
+    if (n <= ws->capacity) return 1;
+
+    size_t bytes = (n + 2) * sizeof(uint32_t) + n * (sizeof(uint32_t) + 2 * sizeof(float));
+    void *block = malloc(bytes);
+    if (!block) return 0;
+
+    free(ws->keys);
+    ws->keys = block;
+    ws->tmp = ws->keys + n + 2;
+    ws->scores = (float *)(ws->tmp + n);
+    ws->labels = ws->scores + n;
+    ws->capacity = n;
+    return 1;
+}
+
+void metrics_workspace_free(MetricsWorkspace *ws) {
+    if (!ws) return;
+    free(ws->keys);
+    metrics_workspace_init(ws);
+}
+
+// Bits d'un flottant rendus ordonnables comme entiers non signés, puis
+// inversés : l'ordre croissant des clés est l'ordre décroissant des scores
+static inline uint32_t score_to_key(float score) {
+    uint32_t u;
+    score += 0.0f;                     // -0 devient +0 : un seul groupe pour zéro
+    memcpy(&u, &score, sizeof(u));
+    u = (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+    return ~u;
+}
+
+static inline float key_to_score(uint32_t key) {
+    uint32_t u = ~key;
+    u = (u & 0x80000000u) ? (u & 0x7fffffffu) : ~u;
+    float score;
+    memcpy(&score, &u, sizeof(score));
+    return score;
+}
+
+// Tri par base LSD de n clés ; les passes dont tous les éléments partagent le
+// même chiffre sont sautées. Le résultat finit dans keys.
+static void radix_sort_keys(uint32_t *keys, uint32_t *tmp, size_t n) {
+    static const int shifts[RADIX_PASSES] = { 0, RADIX_BITS, 2 * RADIX_BITS };
+    size_t counts[RADIX_PASSES][RADIX_BUCKETS];
+    if (n < 2) return;
+    memset(counts, 0, sizeof(counts));
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k = keys[i];
+        for (int p = 0; p < RADIX_PASSES; p++)
+            counts[p][(k >> shifts[p]) & (RADIX_BUCKETS - 1)]++;
+    }
+
+    uint32_t *src = keys, *dst = tmp;
+    for (int p = 0; p < RADIX_PASSES; p++) {
+        size_t *c = counts[p];
+        if (c[(src[0] >> shifts[p]) & (RADIX_BUCKETS - 1)] == n) continue;
+
+        size_t offset = 0;
+        for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+            size_t count = c[b];
+            c[b] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k = src[i];
+            dst[c[(k >> shifts[p]) & (RADIX_BUCKETS - 1)]++] = k;
+        }
+        uint32_t *swap = src; src = dst; dst = swap;
+    }
+    if (src != keys)
+        memcpy(keys, src, n * sizeof(uint32_t));
+}
+
+static void fill_metrics(ThresholdMetrics *m, float threshold, size_t tp, size_t fp,
+                         size_t positives, size_t negatives) {
+    m->threshold = threshold;
+    m->tp = tp;
+    m->fp = fp;
+    m->fn = positives - tp;
+    m->tn = negatives - fp;
+    m->accuracy = (float)(m->tp + m->tn) / (float)(positives + negatives);
+    m->precision = (tp + fp > 0) ? (float)tp / (float)(tp + fp) : 0.0f;
+    m->recall = positives > 0 ? (float)tp / (float)positives : 0.0f;
+    // 2TP / (2TP + FP + FN) : égal à 2PR / (P + R), défini sans cas particulier
+    m->f1 = tp > 0 ? 2.0f * tp / (float)(2 * tp + fp + m->fn) : 0.0f;
+}
+
+// Seuil entre deux scores distincts consécutifs (hi > lo) : le milieu, sauf si
+// l'arrondi le ramène sur hi (scores adjacents en flottant)
+static inline float cut_between(float hi, float lo) {
+    float mid = lo + 0.5f * (hi - lo);
+    return (hi > mid && mid >= lo) ? mid : lo;
+}
+
+void metrics_at_threshold(const MetricsWorkspace *ws, size_t n, float threshold, ThresholdMetrics *out) {
+    size_t positives = 0, tp = 0, fp = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t label = ws->labels[i] > 0.5f;
+        size_t predicted = ws->scores[i] > threshold;
+        positives += label;
+        tp += predicted & label;
+        fp += predicted & (label ^ 1);
+    }
+    fill_metrics(out, threshold, tp, fp, positives, n - positives);
+}
+
+int metrics_sweep(MetricsWorkspace *ws, size_t n, float fixed_threshold,
+                  ThresholdVisitor visit, void *ctx, MetricsSummary *out) {
+    if (!ws || !out || n == 0 || n > ws->capacity) return 0;
+    memset(out, 0, sizeof(*out));
+
+    // Clés réparties par classe puis deux tris : la classe ne voyage pas avec la
+    // clé (4 octets déplacés par score). Positifs en tête, négatifs depuis la fin ;
+    // chaque classe est suivie d'une sentinelle. Répartition sans branchement.
+    uint32_t *keys = ws->keys;
+    size_t positives = 0, negatives_start = n + 1;
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        size_t label = ws->labels[i] > 0.5f;
+        size_t slot = label ? positives : negatives_start - 1;
+        keys[slot] = score_to_key(ws->scores[i]);
+        positives += label;
+        negatives_start -= label ^ 1;
+        sum += ws->scores[i];
+    }
+    size_t negatives = n - positives;
+    uint32_t *pos = keys, *neg = keys + positives + 1;
+    radix_sort_keys(pos, ws->tmp, positives);
+    radix_sort_keys(neg, ws->tmp, negatives);
+    pos[positives] = KEY_SENTINEL;
+    neg[negatives] = KEY_SENTINEL;
+
+    uint32_t first = pos[0] < neg[0] ? pos[0] : neg[0];
+    uint32_t last = positives == 0 ? neg[negatives - 1]
+                  : negatives == 0 ? pos[positives - 1]
+                  : (pos[positives - 1] > neg[negatives - 1] ? pos[positives - 1] : neg[negatives - 1]);
+    out->positives = positives;
+    out->negatives = negatives;
+    out->max_score = key_to_score(first);
+    out->min_score = key_to_score(last);
+    out->mean_score = (float)(sum / (double)n);
+
+    // Coupure initiale : tout est prédit négatif
+    ThresholdMetrics m;
+    fill_metrics(&m, out->max_score, 0, 0, positives, negatives);
+    out->best_f1 = m;
+    if (visit) visit(ctx, &m);
+
+    // Fusion des deux classes, un exemple par pas ; tp et fp sont aussi les
+    // positions dans pos et neg. Un groupe d'ex aequo bascule en entier : un seul
+    // point ROC, évalué quand la clé suivante diffère.
+    size_t tp = 0, fp = 0, group_tp = 0, group_fp = 0;
+    double auc_twice = 0.0;             // Somme des trapèzes (x2), en unités TP x FP
+    int fixed_done = 0;
+    while (tp + fp < n) {
+        uint32_t kp = pos[tp], kn = neg[fp];
+        uint32_t key = kp < kn ? kp : kn;
+        tp += kp == key;
+        fp += kn == key;
+        uint32_t next = pos[tp] < neg[fp] ? pos[tp] : neg[fp];
+        if (next == key) continue;
+
+        float score = key_to_score(key);
+        if (!fixed_done && !(score > fixed_threshold)) {
+            fill_metrics(&out->at_threshold, fixed_threshold, group_tp, group_fp, positives, negatives);
+            fixed_done = 1;
+        }
+        auc_twice += (double)(fp - group_fp) * (double)(tp + group_tp);
+        group_tp = tp;
+        group_fp = fp;
+
+        // F1 seul à chaque seuil ; métriques complètes pour le visiteur ou un nouveau meilleur
+        float f1 = tp > 0 ? 2.0f * tp / (float)(2 * tp + fp + (positives - tp)) : 0.0f;
+        if (!visit && !(f1 > out->best_f1.f1)) continue;
+        float threshold = next != KEY_SENTINEL ? cut_between(score, key_to_score(next))
+                                               : nextafterf(score, -INFINITY);
+        fill_metrics(&m, threshold, tp, fp, positives, negatives);
+        if (m.f1 > out->best_f1.f1) out->best_f1 = m;
+        if (visit) visit(ctx, &m);
+    }
+    if (!fixed_done)
+        fill_metrics(&out->at_threshold, fixed_threshold, tp, fp, positives, negatives);
+
+    out->auc = (positives > 0 && negatives > 0)
+        ? (float)(auc_twice / (2.0 * (double)positives * (double)negatives))
+        : 0.5f;
+    return 1;
+}
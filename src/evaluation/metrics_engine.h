@@ -0,0 +1,60 @@
+#ifndef METRICS_ENGINE_H
+#define METRICS_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// MOTEUR DE MÉTRIQUES EN UN PASSAGE
+// ============================================================================
+// Les scores de chaque classe sont triés une seule fois (tri par base de clés
+// 32 bits, O(n)) puis un unique balayage fusionné dans l'ordre décroissant donne, pour chaque seuil candidat, la
+// matrice de confusion et accuracy / précision / rappel / F1, ainsi que l'AUC
+// (trapèzes, ex aequo traités en bloc). Le meilleur seuil F1 et les métriques
+// à un seuil fixé sortent du même balayage.
+
+// Métriques à un seuil : un exemple est prédit positif si score > threshold
+typedef struct {
+    float threshold;
+    size_t tp, fp, tn, fn;
+    float accuracy;
+    float precision;   // 0 si aucune prédiction positive
+    float recall;      // 0 si aucun positif
+    float f1;
+} ThresholdMetrics;
+
+typedef struct {
+    size_t positives, negatives;
+    float min_score, max_score, mean_score;
+    float auc;                        // 0.5 si une seule classe est présente
+    ThresholdMetrics best_f1;         // Meilleur F1 (seuil le plus haut en cas d'égalité)
+    ThresholdMetrics at_threshold;    // Seuil fixé passé à metrics_sweep
+} MetricsSummary;
+
+// Appelée pour chaque seuil candidat, du plus haut (tout négatif) au plus bas (tout positif)
+typedef void (*ThresholdVisitor)(void *ctx, const ThresholdMetrics *m);
+
+// Tampons réutilisables d'un appel à l'autre : l'appelant remplit scores et
+// labels (label > 0.5 = positif) puis lance le balayage. Non partagé entre threads.
+typedef struct {
+    size_t capacity;
+    float *scores;
+    float *labels;
+    uint32_t *keys;   // Clés de tri (scores ordonnables) : positifs puis négatifs (n + 2 places)
+    uint32_t *tmp;    // Tampon de permutation du tri par base
+} MetricsWorkspace;
+
+void metrics_workspace_init(MetricsWorkspace *ws);
+// Garantit au moins n places (agrandit seulement). Retourne 0 en cas d'échec.
+int metrics_workspace_reserve(MetricsWorkspace *ws, size_t n);
+void metrics_workspace_free(MetricsWorkspace *ws);
+
+// Balayage des n premiers couples (scores finis attendus). visit peut être NULL.
+// Retourne 0 si n == 0 ou si le workspace est trop petit.
+int metrics_sweep(MetricsWorkspace *ws, size_t n, float fixed_threshold,
+                  ThresholdVisitor visit, void *ctx, MetricsSummary *out);
+
+// Métriques à un seul seuil, sans tri (comptage linéaire des n premiers couples)
+void metrics_at_threshold(const MetricsWorkspace *ws, size_t n, float threshold, ThresholdMetrics *out);
+
+#endif
@@ -1,76 +1,161 @@
 #include "roc.h"
+#include "metrics_engine.h"
+#include "../thread_pool.h"
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <math.h>
 
-// Tri, TPR, FPR, AUC : implémentation très simple, à affiner selon besoin.
-int cmp_score(const void *a, const void *b) {
-    float diff = ((float*)b)[1] - ((float*)a)[1];
-    return (diff > 0) - (diff < 0);
-}
+// Tranches de l'AUC par histogramme : une par thread, pas moins de
+// AUC_MIN_CHUNK_SAMPLES exemples chacune (sinon la fusion coûte plus que le comptage)
+#define AUC_MIN_CHUNK_SAMPLES 16384
 
 float compute_auc(const float *y_true, const float *y_score, int n) {
     if (!y_true || !y_score || n <= 0) {
         return 0.5f; // AUC par défaut pour cas invalides
     }
-    
-    // 🔧 CORRECTION 1: Vérifier qu'on a des données valides
-    int valid_samples = 0;
-    for (int i = 0; i < n; i++) {
-        if (!isnan(y_score[i]) && !isinf(y_score[i])) {
-            valid_samples++;
-        }
-    }
-    
-    if (valid_samples < 2) {
-        return 0.5f; // AUC par défaut si pas assez de données valides
+
+    MetricsWorkspace workspace;
+    metrics_workspace_init(&workspace);
+    if (!metrics_workspace_reserve(&workspace, (size_t)n)) {
+        return 0.5f;
     }
-    
-    float arr[n][2];
-    int valid_count = 0;
-    
-    // 🔧 CORRECTION 2: Filtrer les valeurs invalides
+
+    // 🔧 CORRECTION: Filtrer les valeurs invalides
+    size_t valid_count = 0;
     for (int i = 0; i < n; ++i) {
-        if (!isnan(y_score[i]) && !isinf(y_score[i])) {
-            arr[valid_count][0] = y_true[i];
-            arr[valid_count][1] = y_score[i];
+        if (isfinite(y_score[i])) {
+            workspace.scores[valid_count] = y_score[i];
+            workspace.labels[valid_count] = y_true[i];
             valid_count++;
         }
     }
-    
-    if (valid_count < 2) {
-        return 0.5f; // AUC par défaut
+
+    float auc = 0.5f; // AUC par défaut si pas assez de données valides
+    MetricsSummary summary;
+    if (valid_count >= 2 && metrics_sweep(&workspace, valid_count, 0.5f, NULL, NULL, &summary)) {
+        auc = summary.auc;
     }
-    
-    qsort(arr, valid_count, sizeof(arr[0]), cmp_score);
-    
-    // 🔧 CORRECTION 3: Compter les positifs et négatifs avec vérification
-    int P = 0, N = 0;
-    for (int i = 0; i < valid_count; ++i) {
-        if (arr[i][0] > 0.5f) P++; 
-        else N++;
+    metrics_workspace_free(&workspace);
+
+    // 🔧 CORRECTION: Validation du résultat final
+    if (isnan(auc) || auc < 0.0f || auc > 1.0f) {
+        return 0.5f;
     }
-    
-    // 🔧 CORRECTION 4: Gérer les cas où toutes les classes sont identiques
-    if (P == 0 || N == 0) {
-        return 0.5f; // AUC par défaut quand une seule classe présente
+    return auc;
+}
+
+// ============================================================================
+// AUC PAR HISTOGRAMME (linéaire, parallèle)
+// ============================================================================
+
+typedef struct {
+    const float *y_true;
+    const float *y_score;
+    size_t n;
+    size_t num_chunks;
+    float *chunk_min;           // Passe 1 : bornes par tranche
+    float *chunk_max;
+    float lo, scale;            // Passe 2 : case = (score - lo) * scale
+    uint32_t *counts;           // num_chunks x 2 x AUC_HISTOGRAM_BINS (négatifs puis positifs)
+} AucHistogramJob;
+
+static inline void chunk_range(const AucHistogramJob *job, size_t chunk, size_t *begin, size_t *end) {
+    *begin = job->n * chunk / job->num_chunks;
+    *end = job->n * (chunk + 1) / job->num_chunks;
+}
+
+static void auc_range_chunk(void *ctx, size_t first, size_t last) {
+    AucHistogramJob *job = ctx;
+    for (size_t c = first; c < last; c++) {
+        size_t begin, end;
+        chunk_range(job, c, &begin, &end);
+        float lo = INFINITY, hi = -INFINITY;
+        for (size_t i = begin; i < end; i++) {
+            float s = job->y_score[i];
+            if (!isfinite(s)) continue;
+            lo = s < lo ? s : lo;
+            hi = s > hi ? s : hi;
+        }
+        job->chunk_min[c] = lo;
+        job->chunk_max[c] = hi;
     }
-    
-    // 🔧 CORRECTION 5: Calcul AUC avec vérification de division par zéro
-    float tp = 0, fp = 0, prev_fp = 0, prev_tp = 0, auc = 0;
-    for (int i = 0; i < valid_count; ++i) {
-        if (arr[i][0] > 0.5f) tp++; 
-        else fp++;
-        auc += (fp - prev_fp) * (tp + prev_tp) / 2.0f;
-        prev_fp = fp; 
-        prev_tp = tp;
+}
+
+static void auc_histogram_chunk(void *ctx, size_t first, size_t last) {
+    AucHistogramJob *job = ctx;
+    for (size_t c = first; c < last; c++) {
+        size_t begin, end;
+        chunk_range(job, c, &begin, &end);
+        uint32_t *counts = job->counts + c * 2 * AUC_HISTOGRAM_BINS;
+        for (size_t i = begin; i < end; i++) {
+            float s = job->y_score[i];
+            if (!isfinite(s)) continue;
+            size_t bin = (size_t)((s - job->lo) * job->scale);
+            if (bin >= AUC_HISTOGRAM_BINS) bin = AUC_HISTOGRAM_BINS - 1;
+            counts[(job->y_true[i] > 0.5f) * AUC_HISTOGRAM_BINS + bin]++;
+        }
+    }
+}
+
+float compute_auc_histogram(const float *y_true, const float *y_score, size_t n, float *error_bound) {
+    if (error_bound) *error_bound = 0.5f;
+    if (!y_true || !y_score || n < 2) return 0.5f;
+
+    AucHistogramJob job = { y_true, y_score, n, 0, NULL, NULL, 0.0f, 0.0f, NULL };
+    size_t threads = (size_t)thread_pool_num_threads();
+    job.num_chunks = (n + AUC_MIN_CHUNK_SAMPLES - 1) / AUC_MIN_CHUNK_SAMPLES;
+    if (job.num_chunks > threads) job.num_chunks = threads;
+    if (job.num_chunks == 0) job.num_chunks = 1;
+
+    job.chunk_min = malloc(2 * job.num_chunks * sizeof(float));
+    job.counts = calloc(job.num_chunks * 2 * AUC_HISTOGRAM_BINS, sizeof(uint32_t));
+    if (!job.chunk_min || !job.counts) {
+        free(job.chunk_min);
+        free(job.counts);
+        return 0.5f;
     }
-    
-    float final_auc = auc / (P * N);
-    
-    // 🔧 CORRECTION 6: Validation du résultat final
-    if (isnan(final_auc) || isinf(final_auc) || final_auc < 0.0f || final_auc > 1.0f) {
-        return 0.5f; // AUC par défaut pour résultats invalides
+    job.chunk_max = job.chunk_min + job.num_chunks;
+
+    // Passe 1 : étendue des scores valides (réduction des bornes par tranche)
+    parallel_for(job.num_chunks, 1, auc_range_chunk, &job);
+    float lo = INFINITY, hi = -INFINITY;
+    for (size_t c = 0; c < job.num_chunks; c++) {
+        if (job.chunk_min[c] < lo) lo = job.chunk_min[c];
+        if (job.chunk_max[c] > hi) hi = job.chunk_max[c];
     }
-    
-    return final_auc;
-}
\ No newline at end of file
+    job.lo = lo;
+    job.scale = (hi > lo) ? (float)AUC_HISTOGRAM_BINS / (hi - lo) : 0.0f;
+
+    // Passe 2 : histogrammes par tranche, puis fusion dans ceux de la tranche 0
+    float auc = 0.5f;
+    if (lo <= hi) {
+        parallel_for(job.num_chunks, 1, auc_histogram_chunk, &job);
+        uint32_t *merged = job.counts;
+        for (size_t c = 1; c < job.num_chunks; c++) {
+            const uint32_t *counts = job.counts + c * 2 * AUC_HISTOGRAM_BINS;
+            for (size_t b = 0; b < 2 * AUC_HISTOGRAM_BINS; b++)
+                merged[b] += counts[b];
+        }
+
+        // Cases parcourues du score le plus haut au plus bas : chaque négatif
+        // gagne contre les positifs des cases supérieures, moitié dans la sienne
+        const uint32_t *neg = merged, *pos = merged + AUC_HISTOGRAM_BINS;
+        double positives = 0.0, negatives = 0.0, wins = 0.0, same_bin = 0.0;
+        for (size_t b = AUC_HISTOGRAM_BINS; b-- > 0;) {
+            wins += (double)neg[b] * (positives + 0.5 * pos[b]);
+            same_bin += (double)neg[b] * pos[b];
+            positives += pos[b];
+            negatives += neg[b];
+        }
+        if (positives > 0.0 && negatives > 0.0) {
+            double pairs = positives * negatives;
+            auc = (float)(wins / pairs);
+            if (error_bound) *error_bound = (float)(0.5 * same_bin / pairs);
+        }
+    }
+
+    free(job.chunk_min);
+    free(job.counts);
+    return auc;
+}
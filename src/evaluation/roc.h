@@ -1,6 +1,20 @@
 #ifndef ROC_H
 #define ROC_H
 
+#include <stddef.h>
+
+// AUC exacte (rapport final) : tri par base dans des tampons alloués sur le
+// tas, ex aequo comptés pour moitié. Scores NaN/inf ignorés, 0.5 si une seule classe.
 float compute_auc(const float *y_true, const float *y_score, int n);
 
-#endif
\ No newline at end of file
+// AUC approchée en temps linéaire (suivi à chaque époque) : histogrammes de
+// scores à AUC_HISTOGRAM_BINS cases fixes sur [min, max], un par tranche
+// traitée en parallèle, fusionnés par réduction. Seules les paires
+// positif/négatif tombées dans la même case sont approchées (comptées 1/2) :
+//     |AUC approchée - AUC exacte| <= 1/2 * somme_b P_b N_b / (P N)
+// Cette borne est calculée et renvoyée dans *error_bound (si non NULL) ; pour
+// des scores étalés elle est de l'ordre de 1 / (2 * AUC_HISTOGRAM_BINS).
+#define AUC_HISTOGRAM_BINS 4096
+float compute_auc_histogram(const float *y_true, const float *y_score, size_t n, float *error_bound);
+
+#endif
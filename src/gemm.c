@@ -0,0 +1,345 @@
+#include "gemm.h"
+#include "memory.h"
+#include <string.h>
+#include <pthread.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define GEMM_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+// Tailles de blocs (en éléments) : KC x NR de B tient en L1, MC x KC de A en L2,
+// KC x NC de B en L3. MC est multiple de tous les MR, NC de tous les NR.
+#define GEMM_KC 256
+#define GEMM_MC 96
+#define GEMM_NC 2048
+
+// En dessous de ce volume (m * n * k) l'empaquetage coûte plus qu'il ne rapporte
+#define GEMM_SMALL_VOLUME (16 * 16 * 16)
+
+// Taille maximale d'une tuile de registres (AVX-512 : 6 x 32)
+#define GEMM_MAX_TILE (6 * 32)
+
+// Micro-noyau : acc (MR x NR, ordre ligne) = somme sur p < kc de ap[p] (x) bp[p]
+// ap : panneau de A empaqueté (kc x MR), bp : panneau de B empaqueté (kc x NR)
+typedef void (*GemmMicroKernel)(size_t kc, const float *ap, const float *bp, float *acc);
+
+typedef struct {
+    const char *name;
+    size_t mr;
+    size_t nr;
+    GemmMicroKernel kernel;
+} GemmKernelInfo;
+
+// ============================================================================
+// NOYAU PORTABLE (4 x 8, vectorisé par le compilateur si possible)
+// ============================================================================
+
+#define SCALAR_MR 4
+#define SCALAR_NR 8
+
+static void gemm_kernel_scalar(size_t kc, const float *ap, const float *bp, float *acc) {
+    float c[SCALAR_MR][SCALAR_NR] = {{0.0f}};
+    for (size_t p = 0; p < kc; p++) {
+        for (size_t i = 0; i < SCALAR_MR; i++) {
+            float a = ap[i];
+            for (size_t j = 0; j < SCALAR_NR; j++)
+                c[i][j] += a * bp[j];
+        }
+        ap += SCALAR_MR;
+        bp += SCALAR_NR;
+    }
+    memcpy(acc, c, sizeof(c));
+}
+
+#ifdef GEMM_HAVE_X86
+
+// ============================================================================
+// NOYAU AVX2 / FMA (6 x 16 : 12 accumulateurs ymm)
+// ============================================================================
+
+__attribute__((target("avx2,fma")))
+static void gemm_kernel_avx2(size_t kc, const float *ap, const float *bp, float *acc) {
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (size_t p = 0; p < kc; p++) {
+        __m256 b0 = _mm256_loadu_ps(bp);
+        __m256 b1 = _mm256_loadu_ps(bp + 8);
+        __m256 a;
+        a = _mm256_broadcast_ss(ap + 0); c00 = _mm256_fmadd_ps(a, b0, c00); c01 = _mm256_fmadd_ps(a, b1, c01);
+        a = _mm256_broadcast_ss(ap + 1); c10 = _mm256_fmadd_ps(a, b0, c10); c11 = _mm256_fmadd_ps(a, b1, c11);
+        a = _mm256_broadcast_ss(ap + 2); c20 = _mm256_fmadd_ps(a, b0, c20); c21 = _mm256_fmadd_ps(a, b1, c21);
+        a = _mm256_broadcast_ss(ap + 3); c30 = _mm256_fmadd_ps(a, b0, c30); c31 = _mm256_fmadd_ps(a, b1, c31);
+        a = _mm256_broadcast_ss(ap + 4); c40 = _mm256_fmadd_ps(a, b0, c40); c41 = _mm256_fmadd_ps(a, b1, c41);
+        a = _mm256_broadcast_ss(ap + 5); c50 = _mm256_fmadd_ps(a, b0, c50); c51 = _mm256_fmadd_ps(a, b1, c51);
+        ap += 6;
+        bp += 16;
+    }
+
+    _mm256_storeu_ps(acc + 0 * 16, c00); _mm256_storeu_ps(acc + 0 * 16 + 8, c01);
+    _mm256_storeu_ps(acc + 1 * 16, c10); _mm256_storeu_ps(acc + 1 * 16 + 8, c11);
+    _mm256_storeu_ps(acc + 2 * 16, c20); _mm256_storeu_ps(acc + 2 * 16 + 8, c21);
+    _mm256_storeu_ps(acc + 3 * 16, c30); _mm256_storeu_ps(acc + 3 * 16 + 8, c31);
+    _mm256_storeu_ps(acc + 4 * 16, c40); _mm256_storeu_ps(acc + 4 * 16 + 8, c41);
+    _mm256_storeu_ps(acc + 5 * 16, c50); _mm256_storeu_ps(acc + 5 * 16 + 8, c51);
+}
+
+// ============================================================================
+// NOYAU AVX-512 (6 x 32 : 12 accumulateurs zmm)
+// ============================================================================
+
+__attribute__((target("avx512f")))
+static void gemm_kernel_avx512(size_t kc, const float *ap, const float *bp, float *acc) {
+    __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+    __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+
+    for (size_t p = 0; p < kc; p++) {
+        __m512 b0 = _mm512_loadu_ps(bp);
+        __m512 b1 = _mm512_loadu_ps(bp + 16);
+        __m512 a;
+        a = _mm512_set1_ps(ap[0]); c00 = _mm512_fmadd_ps(a, b0, c00); c01 = _mm512_fmadd_ps(a, b1, c01);
+        a = _mm512_set1_ps(ap[1]); c10 = _mm512_fmadd_ps(a, b0, c10); c11 = _mm512_fmadd_ps(a, b1, c11);
+        a = _mm512_set1_ps(ap[2]); c20 = _mm512_fmadd_ps(a, b0, c20); c21 = _mm512_fmadd_ps(a, b1, c21);
+        a = _mm512_set1_ps(ap[3]); c30 = _mm512_fmadd_ps(a, b0, c30); c31 = _mm512_fmadd_ps(a, b1, c31);
+        a = _mm512_set1_ps(ap[4]); c40 = _mm512_fmadd_ps(a, b0, c40); c41 = _mm512_fmadd_ps(a, b1, c41);
+        a = _mm512_set1_ps(ap[5]); c50 = _mm512_fmadd_ps(a, b0, c50); c51 = _mm512_fmadd_ps(a, b1, c51);
+        ap += 6;
+        bp += 32;
+    }
+
+    _mm512_storeu_ps(acc + 0 * 32, c00); _mm512_storeu_ps(acc + 0 * 32 + 16, c01);
+    _mm512_storeu_ps(acc + 1 * 32, c10); _mm512_storeu_ps(acc + 1 * 32 + 16, c11);
+    _mm512_storeu_ps(acc + 2 * 32, c20); _mm512_storeu_ps(acc + 2 * 32 + 16, c21);
+    _mm512_storeu_ps(acc + 3 * 32, c30); _mm512_storeu_ps(acc + 3 * 32 + 16, c31);
+    _mm512_storeu_ps(acc + 4 * 32, c40); _mm512_storeu_ps(acc + 4 * 32 + 16, c41);
+    _mm512_storeu_ps(acc + 5 * 32, c50); _mm512_storeu_ps(acc + 5 * 32 + 16, c51);
+}
+
+#endif /* GEMM_HAVE_X86 */
+
+// ============================================================================
+// SÉLECTION DU NOYAU
+// ============================================================================
+
+static const GemmKernelInfo kernel_scalar = { "scalar", SCALAR_MR, SCALAR_NR, gemm_kernel_scalar };
+#ifdef GEMM_HAVE_X86
+static const GemmKernelInfo kernel_avx2   = { "avx2",   6, 16, gemm_kernel_avx2 };
+static const GemmKernelInfo kernel_avx512 = { "avx512", 6, 32, gemm_kernel_avx512 };
+#endif
+
+static const GemmKernelInfo *active_kernel = NULL;
+static int force_scalar = 0;
+static pthread_once_t kernel_once = PTHREAD_ONCE_INIT;
+
+static void gemm_select(void) {
+    const GemmKernelInfo *selected = &kernel_scalar;
+#ifdef GEMM_HAVE_X86
+    if (!force_scalar) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            selected = &kernel_avx512;
+        else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            selected = &kernel_avx2;
+    }
+#endif
+    active_kernel = selected;
+}
+
+// Choix fait une seule fois, même si plusieurs threads appellent gemm en même temps
+void gemm_init(void) {
+    pthread_once(&kernel_once, gemm_select);
+}
+
+const char *gemm_kernel_name(void) {
+    gemm_init();
+    return active_kernel->name;
+}
+
+void gemm_force_scalar(int enable) {
+    gemm_init();
+    force_scalar = enable;
+    gemm_select();
+}
+
+// ============================================================================
+// EMPAQUETAGE
+// ============================================================================
+
+// Tampons d'empaquetage propres à chaque thread, agrandis à la demande et
+// libérés à la sortie du thread
+typedef struct {
+    float *data;
+    size_t cap;
+} PackBuffer;
+
+static __thread PackBuffer pack_a_buf = { NULL, 0 };
+static __thread PackBuffer pack_b_buf = { NULL, 0 };
+
+static void pack_release(void *slot) {
+    PackBuffer *buf = slot;
+    mem_aligned_free(buf->data);
+    buf->data = NULL;
+    buf->cap = 0;
+}
+
+static float *pack_reserve(PackBuffer *buf, size_t count) {
+    if (count > buf->cap) {
+        if (!buf->data) mem_thread_at_exit(pack_release, buf);
+        mem_aligned_free(buf->data);
+        buf->data = mem_aligned_alloc(64, count * sizeof(float));
+        buf->cap = count;
+    }
+    return buf->data;
+}
+
+// Empaqueter un bloc mc x kc de A en panneaux de MR lignes (complétés par des zéros)
+static void pack_a(size_t mc, size_t kc, const float *a, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                   size_t mr, float *dst) {
+    for (size_t ir = 0; ir < mc; ir += mr) {
+        size_t rows = (mc - ir < mr) ? mc - ir : mr;
+        const float *src = a + (ptrdiff_t)ir * rs_a;
+        for (size_t p = 0; p < kc; p++) {
+            size_t i = 0;
+            for (; i < rows; i++)
+                dst[i] = src[(ptrdiff_t)i * rs_a + (ptrdiff_t)p * cs_a];
+            for (; i < mr; i++)
+                dst[i] = 0.0f;
+            dst += mr;
+        }
+    }
+}
+
+// Empaqueter un bloc kc x nc de B en panneaux de NR colonnes (complétés par des zéros)
+static void pack_b(size_t kc, size_t nc, const float *b, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                   size_t nr, float *dst) {
+    for (size_t jr = 0; jr < nc; jr += nr) {
+        size_t cols = (nc - jr < nr) ? nc - jr : nr;
+        const float *src = b + (ptrdiff_t)jr * cs_b;
+        for (size_t p = 0; p < kc; p++) {
+            const float *row = src + (ptrdiff_t)p * rs_b;
+            size_t j = 0;
+            if (cs_b == 1) {
+                memcpy(dst, row, cols * sizeof(float));
+                j = cols;
+            } else {
+                for (; j < cols; j++)
+                    dst[j] = row[(ptrdiff_t)j * cs_b];
+            }
+            for (; j < nr; j++)
+                dst[j] = 0.0f;
+            dst += nr;
+        }
+    }
+}
+
+// Écrire une tuile : C = alpha * acc + beta * C (C non lu si beta == 0)
+static void store_tile(size_t rows, size_t cols, const float *acc, size_t nr,
+                       float alpha, float beta, float *c, ptrdiff_t rs_c, ptrdiff_t cs_c) {
+    for (size_t i = 0; i < rows; i++) {
+        float *crow = c + (ptrdiff_t)i * rs_c;
+        const float *arow = acc + i * nr;
+        if (beta == 0.0f) {
+            for (size_t j = 0; j < cols; j++)
+                crow[(ptrdiff_t)j * cs_c] = alpha * arow[j];
+        } else {
+            for (size_t j = 0; j < cols; j++)
+                crow[(ptrdiff_t)j * cs_c] = alpha * arow[j] + beta * crow[(ptrdiff_t)j * cs_c];
+        }
+    }
+}
+
+// C = beta * C (cas dégénérés k == 0 ou alpha == 0)
+static void scale_c(size_t m, size_t n, float beta, float *c, ptrdiff_t rs_c, ptrdiff_t cs_c) {
+    for (size_t i = 0; i < m; i++)
+        for (size_t j = 0; j < n; j++) {
+            float *cij = c + (ptrdiff_t)i * rs_c + (ptrdiff_t)j * cs_c;
+            *cij = (beta == 0.0f) ? 0.0f : beta * *cij;
+        }
+}
+
+// Petits produits : boucle directe i-p-j sans empaquetage
+static void gemm_small(size_t m, size_t n, size_t k, float alpha,
+                       const float *a, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                       const float *b, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                       float beta, float *c, ptrdiff_t rs_c, ptrdiff_t cs_c) {
+    scale_c(m, n, beta, c, rs_c, cs_c);
+    for (size_t i = 0; i < m; i++) {
+        float *crow = c + (ptrdiff_t)i * rs_c;
+        for (size_t p = 0; p < k; p++) {
+            float aip = alpha * a[(ptrdiff_t)i * rs_a + (ptrdiff_t)p * cs_a];
+            const float *brow = b + (ptrdiff_t)p * rs_b;
+            for (size_t j = 0; j < n; j++)
+                crow[(ptrdiff_t)j * cs_c] += aip * brow[(ptrdiff_t)j * cs_b];
+        }
+    }
+}
+
+// ============================================================================
+// PRODUIT PAR BLOCS
+// ============================================================================
+
+void gemm(size_t m, size_t n, size_t k,
+          float alpha,
+          const float *a, ptrdiff_t rs_a, ptrdiff_t cs_a,
+          const float *b, ptrdiff_t rs_b, ptrdiff_t cs_b,
+          float beta,
+          float *c, ptrdiff_t rs_c, ptrdiff_t cs_c) {
+    if (m == 0 || n == 0) return;
+    if (k == 0 || alpha == 0.0f) {
+        scale_c(m, n, beta, c, rs_c, cs_c);
+        return;
+    }
+    if (m * n * k <= GEMM_SMALL_VOLUME) {
+        gemm_small(m, n, k, alpha, a, rs_a, cs_a, b, rs_b, cs_b, beta, c, rs_c, cs_c);
+        return;
+    }
+
+    gemm_init();
+    const GemmKernelInfo *kern = active_kernel;
+    const size_t mr = kern->mr, nr = kern->nr;
+
+    float acc[GEMM_MAX_TILE] __attribute__((aligned(64)));
+
+    for (size_t jc = 0; jc < n; jc += GEMM_NC) {
+        size_t nc = (n - jc < GEMM_NC) ? n - jc : GEMM_NC;
+        size_t nc_padded = (nc + nr - 1) / nr * nr;
+
+        for (size_t pc = 0; pc < k; pc += GEMM_KC) {
+            size_t kc = (k - pc < GEMM_KC) ? k - pc : GEMM_KC;
+            // Le premier bloc de k applique beta, les suivants accumulent
+            float beta_eff = (pc == 0) ? beta : 1.0f;
+
+            float *bp = pack_reserve(&pack_b_buf, kc * nc_padded);
+            pack_b(kc, nc, b + (ptrdiff_t)pc * rs_b + (ptrdiff_t)jc * cs_b, rs_b, cs_b, nr, bp);
+
+            for (size_t ic = 0; ic < m; ic += GEMM_MC) {
+                size_t mc = (m - ic < GEMM_MC) ? m - ic : GEMM_MC;
+                size_t mc_padded = (mc + mr - 1) / mr * mr;
+
+                float *ap = pack_reserve(&pack_a_buf, mc_padded * kc);
+                pack_a(mc, kc, a + (ptrdiff_t)ic * rs_a + (ptrdiff_t)pc * cs_a, rs_a, cs_a, mr, ap);
+
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    size_t cols = (nc - jr < nr) ? nc - jr : nr;
+                    const float *bpanel = bp + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += mr) {
+                        size_t rows = (mc - ir < mr) ? mc - ir : mr;
+                        kern->kernel(kc, ap + ir * kc, bpanel, acc);
+                        store_tile(rows, cols, acc, nr, alpha, beta_eff,
+                                   c + (ptrdiff_t)(ic + ir) * rs_c + (ptrdiff_t)(jc + jr) * cs_c,
+                                   rs_c, cs_c);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef GEMM_H
+#define GEMM_H
+
+#include <stddef.h>
+
+// Produit matriciel général C = alpha * A * B + beta * C (simple précision)
+//
+// A est m x k, B est k x n, C est m x n. Chaque opérande est décrit par
+// un pointeur sur son premier élément et deux pas (en floats) :
+//   A(i, p) = A[i * rs_a + p * cs_a]
+// ce qui permet de passer directement des vues transposées ou des sous-blocs.
+// Si beta == 0, C n'est pas lu (il peut contenir des valeurs non initialisées).
+//
+// Implémentation : empaquetage par blocs (KC x NC pour B, MC x KC pour A)
+// et micro-noyau à registres MR x NR. Le noyau (AVX-512, AVX2/FMA ou
+// portable) est choisi une fois à l'exécution selon le CPU.
+void gemm(size_t m, size_t n, size_t k,
+          float alpha,
+          const float *a, ptrdiff_t rs_a, ptrdiff_t cs_a,
+          const float *b, ptrdiff_t rs_b, ptrdiff_t cs_b,
+          float beta,
+          float *c, ptrdiff_t rs_c, ptrdiff_t cs_c);
+
+// Sélection du noyau (appel facultatif : effectuée automatiquement au premier gemm)
+void gemm_init(void);
+
+// Nom du noyau actif ("avx512", "avx2", "scalar")
+const char *gemm_kernel_name(void);
+
+// Forcer le noyau portable (tests, comparaison de performances)
+void gemm_force_scalar(int enable);
+
+#endif /* GEMM_H */
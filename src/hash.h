@@ -0,0 +1,28 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// HASH FNV-1a 64 BITS
+// ============================================================================
+// Empreintes non cryptographiques, à chaîner : h = hash_fnv1a(h, data, n),
+// départ 0 (remplacé par la base FNV). Les empreintes écrites sur disque
+// (journal du balayage, cache des datasets) doivent rester identiques d'une
+// version à l'autre : ne pas changer la fonction sans changer de format.
+
+#define HASH_FNV1A_OFFSET 0xcbf29ce484222325ULL
+#define HASH_FNV1A_PRIME 0x100000001b3ULL
+
+static inline uint64_t hash_fnv1a(uint64_t h, const void *data, size_t n) {
+    const unsigned char *bytes = data;
+    if (h == 0) h = HASH_FNV1A_OFFSET;
+    for (size_t i = 0; i < n; i++) {
+        h ^= bytes[i];
+        h *= HASH_FNV1A_PRIME;
+    }
+    return h;
+}
+
+#endif /* HASH_H */
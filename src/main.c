@@ -5,6 +5,7 @@
 #include <time.h>
 #include <math.h>
 #include <unistd.h>
+#include <pthread.h>
 #include "rich_config.h"
 #include "adaptive_optimizer.h"
 #include "data/dataset.h"
@@ -21,6 +22,7 @@
 #include "training/progressive.h"
 #include "training/swarm.h"
 #include "training/propagation.h"
+#include "training/health_monitor.h"
 #include "args_parser.h"
 #include "neural/layer.h"
 #include "training/trainer.h"
@@ -28,9 +30,16 @@
 #include "evaluation/confusion_matrix.h"
 #include "evaluation/f1_score.h"
 #include "evaluation/roc.h"
+#include "evaluation/metrics_engine.h"
 #include "progress_bar.h"
 #include "colored_output.h"
 #include "model_saver/model_saver.h"
+#include "sweep_executor.h"
+#include "sweep_journal.h"
+#include "csv_export_complete.h"
+#include "rng.h"
+#include "hash.h"
+#include "memory.h"
 
 // Macro pour les messages de debug conditionnels
 #define DEBUG_PRINTF(config, ...) do { \
@@ -48,6 +57,8 @@ static char **argv_global = NULL;
 
 // Variable globale pour le ModelSaver
 static ModelSaver *global_model_saver = NULL;
+// Les essais parallèles (--jobs) proposent leurs modèles depuis plusieurs threads
+static pthread_mutex_t model_saver_lock = PTHREAD_MUTEX_INITIALIZER;
 
 // Initialiser le système de sauvegarde des 10 meilleurs modèles avec nom de dataset
 int init_best_models_manager_with_dataset(const char *base_directory, const char *dataset_name) {
@@ -98,8 +109,11 @@ int add_candidate_model(const char *model_name, const char *optimizer, const cha
     
     // Ajouter le modèle candidat (sans le réseau pour éviter les problèmes mémoire)
     // On utilise NULL pour le réseau car on ne sauvegarde que les métadonnées
-    return model_saver_add_candidate(global_model_saver, NULL, &trainer,
-                                   accuracy, loss, val_accuracy, val_loss, epoch);
+    pthread_mutex_lock(&model_saver_lock);
+    int result = model_saver_add_candidate(global_model_saver, NULL, &trainer,
+                                           accuracy, loss, val_accuracy, val_loss, epoch);
+    pthread_mutex_unlock(&model_saver_lock);
+    return result;
 }
 
 // Finaliser la sauvegarde des meilleurs modèles
@@ -152,6 +166,9 @@ typedef struct {
     float recall;
     float f1_score;
     float auc_roc;
+    // Distribution des scores (surveillance de santé des essais)
+    float score_min, score_max;
+    int nonfinite_scores;
 } AllMetrics;
 
 // Système de cache pour les architectures (nouveau)
@@ -264,50 +281,49 @@ ArchitectureCache* get_cached_architecture(int optimizer_idx, int activation_idx
     return NULL;
 }
 
+static void metrics_workspace_release(void *slot) {
+    metrics_workspace_free(slot);
+}
+
 // Fonction pour calculer toutes les métriques (CORRIGÉE pour de meilleures performances)
-AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const RichConfig *config) {
+// exact = 1 (rapport final) : tri et balayage exact ; exact = 0 (suivi par époque) :
+// comptage au seuil et AUC par histogramme, en temps linéaire
+AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const RichConfig *config, int exact) {
     AllMetrics metrics = {0};
     
     if (!network || !dataset || dataset->num_samples == 0) {
         return metrics;
     }
     
-    // Désactiver dropout pour évaluation
-    network_set_dropout_simple(network, 0);
-    
-    // Préparer les tableaux pour les prédictions
-    float *y_true = malloc(dataset->num_samples * sizeof(float));
-    float *y_pred = malloc(dataset->num_samples * sizeof(float));
-    float *y_scores = malloc(dataset->num_samples * sizeof(float)); // Pour AUC-ROC
-    int *y_true_int = malloc(dataset->num_samples * sizeof(int));
-    int *y_pred_int = malloc(dataset->num_samples * sizeof(int));
-    
-    if (!y_true || !y_pred || !y_scores || !y_true_int || !y_pred_int) {
-        printf("Erreur: allocation mémoire pour les métriques\n");
-        free(y_true); free(y_pred); free(y_scores); free(y_true_int); free(y_pred_int);
+    // Sorties de tout le dataset en un appel (GEMM par lots, multi-thread) :
+    // le réseau n'est que lu, pas de dropout. Les tampons du moteur de métriques
+    // sont gardés d'un appel à l'autre (un jeu par thread, libéré à sa sortie).
+    static __thread MetricsWorkspace workspace;
+    if (!workspace.keys) mem_thread_at_exit(metrics_workspace_release, &workspace);
+    size_t num_samples = dataset->num_samples;
+    size_t output_size = network->layers[network->num_layers - 1]->output_size;
+    
+    if (!metrics_workspace_reserve(&workspace, num_samples * output_size) ||
+        !network_predict_batch(network, dataset, workspace.scores)) {
+        printf("Erreur: allocation mémoire ou prédiction pour les métriques\n");
         return metrics;
     }
     
     // 🔧 CORRECTION CRITIQUE: Analyser les prédictions pour debug
-    int predictions_0 = 0, predictions_1 = 0;
     int targets_0 = 0, targets_1 = 0;
     float min_score = 1.0f, max_score = 0.0f;
     float sum_scores = 0.0f;
     int valid_predictions = 0;
     
-    // 🚨 CORRECTION CRITIQUE: Faire les prédictions correctement
-    for (size_t i = 0; i < dataset->num_samples; i++) {
-        network_forward_simple(network, dataset->inputs[i]);
-        
-        float *output = network_output_simple(network);
-        if (!output) continue;
-        
-        float prediction_score = output[0]; // Score brut (probabilité)
+    // Score = première sortie de chaque ligne, ramenée en tête du tampon (sur place)
+    for (size_t i = 0; i < num_samples; i++) {
+        float prediction_score = workspace.scores[i * output_size]; // Score brut (probabilité)
         float target = dataset->outputs[i][0];
         
         // 🔧 CORRECTION: Vérifier que les scores sont valides
         if (isnan(prediction_score) || isinf(prediction_score)) {
             prediction_score = 0.5f; // Score par défaut
+            metrics.nonfinite_scores++;
         }
         
         // 🔧 CORRECTION: Analyser la distribution des scores
@@ -316,14 +332,16 @@ AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const R
         sum_scores += prediction_score;
         valid_predictions++;
         
-        y_true[i] = target;
-        y_scores[i] = prediction_score;
-        y_true_int[i] = (int)(target > 0.5f ? 1 : 0);
+        workspace.scores[i] = prediction_score;
+        workspace.labels[i] = target;
         
         // Compter les distributions des targets
         if (target > 0.5f) targets_1++; else targets_0++;
     }
     
+    metrics.score_min = min_score;
+    metrics.score_max = max_score;
+    
     // 🔧 CORRECTION MAJEURE: Calcul du seuil optimal dynamique
     float optimal_threshold = 0.5f; // Seuil par défaut
     
@@ -356,26 +374,34 @@ AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const R
         }
     }
     
-    // Appliquer le seuil optimal pour les prédictions
-    for (size_t i = 0; i < dataset->num_samples; i++) {
-        float prediction_class = (y_scores[i] > optimal_threshold) ? 1.0f : 0.0f;
-        y_pred[i] = prediction_class;
-        y_pred_int[i] = (int)(prediction_class > 0.5f ? 1 : 0);
-        
-        // Compter les distributions des prédictions
-        if (prediction_class > 0.5f) predictions_1++; else predictions_0++;
+    // Mode exact : un seul tri et un seul balayage (matrice de confusion au seuil
+    // retenu, AUC et meilleur seuil F1). Sinon : comptage et histogrammes, sans tri.
+    MetricsSummary summary;
+    float auc_error = 0.0f;
+    if (exact) {
+        if (!metrics_sweep(&workspace, num_samples, optimal_threshold, NULL, NULL, &summary)) {
+            return metrics;
+        }
+    } else {
+        metrics_at_threshold(&workspace, num_samples, optimal_threshold, &summary.at_threshold);
+        summary.auc = compute_auc_histogram(workspace.labels, workspace.scores, num_samples, &auc_error);
     }
+    const ThresholdMetrics *at = &summary.at_threshold;
+    int TP = (int)at->tp, TN = (int)at->tn, FP = (int)at->fp, FN = (int)at->fn;
+    int predictions_1 = TP + FP, predictions_0 = TN + FN;
     
     // 🔧 DEBUG: Afficher les statistiques de prédiction
     DEBUG_PRINTF(config, "🔍 Debug Métriques: Scores [%.4f, %.4f] | Pred[0:%d, 1:%d] | True[0:%d, 1:%d] | Seuil: %.4f\n", 
            min_score, max_score, predictions_0, predictions_1, targets_0, targets_1, optimal_threshold);
+    if (exact) {
+        DEBUG_PRINTF(config, "   Meilleur F1 du balayage: %.3f au seuil %.4f\n",
+               summary.best_f1.f1, summary.best_f1.threshold);
+    } else {
+        DEBUG_PRINTF(config, "   AUC par histogramme: erreur <= %.5f\n", auc_error);
+    }
     
-    // 1. Accuracy - utiliser les valeurs float pour plus de précision
-    metrics.accuracy = accuracy(y_true, y_pred, dataset->num_samples);
-    
-    // 2. Confusion Matrix pour Precision, Recall, F1
-    int TP, TN, FP, FN;
-    compute_confusion_matrix(y_true_int, y_pred_int, dataset->num_samples, &TP, &TN, &FP, &FN);
+    // 1. Accuracy
+    metrics.accuracy = at->accuracy;
     
     // 🔧 DEBUG: Afficher la matrice de confusion
     DEBUG_PRINTF(config, "   Matrice: TP=%d FP=%d FN=%d TN=%d\n", TP, FP, FN, TN);
@@ -425,8 +451,8 @@ AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const R
         metrics.f1_score = f1_check;
     }
     
-    // 4. AUC-ROC avec vérification de validité (maintenant robuste)
-    metrics.auc_roc = compute_auc(y_true, y_scores, dataset->num_samples);
+    // 4. AUC-ROC (ex aequo comptés pour moitié)
+    metrics.auc_roc = summary.auc;
     
     // 🔧 CORRECTION 4: Validation des métriques calculées
     // S'assurer que toutes les métriques sont dans des plages valides
@@ -451,16 +477,6 @@ AllMetrics compute_all_metrics(NeuralNetwork *network, Dataset *dataset, const R
         }
     }
     
-    // Réactiver dropout pour entraînement
-    network_set_dropout_simple(network, 1);
-    
-    // Nettoyage
-    free(y_true);
-    free(y_pred);
-    free(y_scores);
-    free(y_true_int);
-    free(y_pred_int);
-    
     return metrics;
 }
 
@@ -688,6 +704,22 @@ TrainingStrategyFn get_train_strategy(const char *name) {
     return train_standard;
 }
 
+// Brancher l'optimiseur nommé (optimizers/) sur l'arène d'un réseau simple.
+// "sgd" conserve le SGD + momentum intégré au réseau. Retourne l'état à libérer
+// avec trainer_free_optimizer_state (NULL si aucun optimiseur externe).
+static void *attach_named_optimizer(NeuralNetwork *network, const char *optimizer, float lr) {
+    if (!network || !network->arena || strcmp(optimizer, "sgd") == 0) return NULL;
+    
+    void *state = trainer_create_optimizer_state(optimizer, network->arena->size, lr);
+    OptimizerUpdateFn update = trainer_get_optimizer_update(optimizer);
+    if (!state || !update) {
+        trainer_free_optimizer_state(optimizer, state);
+        return NULL;
+    }
+    network_attach_optimizer_simple(network, state, update);
+    return state;
+}
+
 // Conversion Activation YAML -> tableau de strings (pour le réseau)
 void extract_activations(const RichConfig *cfg, int a_idx, int n_layers, char act_names[][64]) {
     // Préparer les activations pour chaque couche
@@ -844,6 +876,7 @@ int test_all_optimizers() {
         float learning_rate = 0.001f;
         if (strcmp(optimizers[i], "sgd") == 0) learning_rate = 0.01f;
         if (strcmp(optimizers[i], "lion") == 0) learning_rate = 0.0001f;
+        void *optimizer_state = attach_named_optimizer(network, optimizers[i], learning_rate);
         
         int convergence_epoch = -1;
         
@@ -881,6 +914,7 @@ int test_all_optimizers() {
         }
         
         network_free_simple(network);
+        trainer_free_optimizer_state(optimizers[i], optimizer_state);
     }
     
     printf("\n🏆 Test de tous les optimiseurs terminé !\n");
@@ -1098,11 +1132,1116 @@ int test_complete_combinations() {
     return 0;
 }
 
+// ============================================================================
+// BALAYAGE EXHAUSTIF : ESSAIS INDÉPENDANTS, EN SÉRIE OU EN PARALLÈLE (--jobs N)
+// ============================================================================
+
+#define SWEEP_TRIALS_PER_COMBINATION 5
+
+// --search : balayage exhaustif (défaut) ou élagage par paliers (successive halving)
+typedef enum {
+    SWEEP_SEARCH_EXHAUSTIVE,
+    SWEEP_SEARCH_HYPERBAND
+} SweepSearchMode;
+
+#define HYPERBAND_ETA 3             // Un tiers des combinaisons promu à chaque palier
+#define HYPERBAND_MIN_EPOCHS 5      // Budget du premier palier, au moins
+#define HYPERBAND_MIN_FINALISTS 10  // Jamais moins de finalistes que le TOP 10 affiché
+#define HYPERBAND_MAX_RUNGS 8
+
+// --sequential : essais ajoutés un par un tant que le F1 moyen d'une combinaison
+// reste incertain (intervalle de confiance à 95%, loi de Student)
+#define SEQUENTIAL_MIN_TRIALS 3
+#define SEQUENTIAL_MAX_TRIALS 10
+#define SEQUENTIAL_CI_HALF_WIDTH 0.01f  // ±1 point de F1 : estimation jugée assez précise
+#define SEQUENTIAL_TOP_K 10             // Places disputées au dernier palier (TOP 10 affiché)
+
+// Raison de l'arrêt des essais d'une combinaison
+typedef enum {
+    TRIALS_FIXED,               // Nombre d'essais fixe (mode par défaut)
+    TRIALS_RUNNING,             // Encore incertaine : un essai de plus
+    TRIALS_PRECISE,             // Intervalle de confiance assez étroit
+    TRIALS_OUT_OF_TOP,          // Ne peut plus atteindre les places disputées
+    TRIALS_CAPPED               // SEQUENTIAL_MAX_TRIALS atteint
+} TrialsStop;
+
+static const char *trials_stop_name(TrialsStop stop) {
+    switch (stop) {
+        case TRIALS_PRECISE: return "precis";
+        case TRIALS_OUT_OF_TOP: return "hors_top";
+        case TRIALS_CAPPED: return "plafond";
+        case TRIALS_RUNNING: return "en_cours";
+        default: return "fixe";
+    }
+}
+
+// Options du test exhaustif lues sur la ligne de commande
+typedef struct {
+    int jobs;                   // --jobs N
+    SweepSearchMode search;     // --search
+    const char *journal_path;   // --journal PATH (NULL : sweep_journal_<dataset>.log)
+    int resume;                 // --resume : reprendre les essais déjà journalisés
+    int sequential;             // --sequential : nombre d'essais adaptatif par combinaison
+} SweepOptions;
+
+// Résultat d'une combinaison : moyennes et meilleures valeurs sur ses essais
+typedef struct {
+    char method[32];
+    char optimizer[32];
+    char activation[32];
+    char full_name[128];
+    // Métriques moyennes sur tous les essais
+    float avg_accuracy;
+    float avg_precision;
+    float avg_recall;
+    float avg_f1_score;
+    float avg_auc_roc;
+    // Meilleures métriques obtenues
+    float best_accuracy;
+    float best_precision;
+    float best_recall;
+    float best_f1_score;
+    float best_auc_roc;
+    // Informations de convergence
+    int convergence_count;
+    int total_trials;
+    float convergence_rate;
+    // Dernier palier atteint (0 en mode exhaustif) et son budget d'époques
+    int rung;
+    int rung_epochs;
+    // Demi-largeur de l'intervalle de confiance à 95% du F1 moyen, et arrêt des essais
+    float f1_ci95;
+    TrialsStop trials_stop;
+    int unhealthy_trials;       // Essais arrêtés par la surveillance de santé
+} CombinationResult;
+
+// Résultat d'un essai, écrit dans son propre emplacement
+typedef struct {
+    AllMetrics best;            // Meilleures métriques (F1) de l'essai
+    int converged;
+    int convergence_epoch;
+    float final_loss;
+    float lr;
+    HealthStatus health;        // Verdict de la surveillance de santé (HEALTH_OK : essai mené à terme)
+    int restarts;               // Redémarrages avec une nouvelle graine
+    int epochs_run;             // Époques de la dernière tentative
+} TrialOutcome;
+
+// Essai t : combinaison t / trials (méthode, puis optimiseur, puis activation), essai t % trials.
+// Un palier exécute les essais des combinaisons de active[] avec max_epochs époques, par
+// vagues : chaque vague complète une combinaison jusqu'à trials_planned[c] essais.
+// Les datasets et la configuration ne sont que lus par les essais.
+typedef struct {
+    const char **neuroplast_methods;
+    const char **optimizers;
+    const char **activations;
+    int num_methods;
+    int num_optimizers;
+    int num_activations;
+    int trials;                 // Essais possibles par combinaison (pas du tableau outcomes)
+    int sequential;             // Essais ajoutés tant que le F1 moyen est incertain
+    int max_epochs;             // Budget du palier en cours
+    const int *active;          // Combinaisons évaluées au palier en cours
+    int num_active;
+    int rung;
+    int num_rungs;
+    const RichConfig *config;
+    Dataset *dataset;
+    Dataset *train_set;
+    Dataset *test_set;
+    uint64_t base_seed;
+    SweepJournal *journal;      // Essais terminés (reprise) et journalisation ; NULL si désactivé
+    int compact;                // Plusieurs essais à la fois ou recherche par paliers : affichage compact, sans barres
+    
+    // État partagé, protégé par lock
+    pthread_mutex_t lock;
+    TrialOutcome *outcomes;     // combinaisons x essais
+    int *trials_done;           // Essais terminés par combinaison
+    int *trials_planned;        // Essais demandés par combinaison au palier en cours
+    CombinationResult *results; // Rempli quand tous les essais d'une combinaison sont finis
+    int combinations_done;
+    int trials_resumed;         // Essais repris du journal au lieu d'être entraînés
+    
+    // Essais d'entraînement identique (même empreinte) : un seul est exécuté
+    size_t *run_tasks;          // Essais exécutés au palier en cours (un par empreinte)
+    size_t num_run_tasks;
+    size_t *next_alias;         // Essai suivant de même empreinte, ou SWEEP_NO_ALIAS
+    int trials_deduplicated;
+    
+    // Surveillance de santé : essais exécutés par verdict, redémarrages, époques évitées
+    int health_counts[HEALTH_STATUS_COUNT];
+    int health_restarts;
+    long health_epochs_saved;
+    int general_bar, trials_bar, epochs_bar;
+} SweepContext;
+
+#define SWEEP_NO_ALIAS ((size_t)-1)
+
+// Graine d'un essai : dérivée de la configuration d'entraînement et du numéro
+// d'essai, pas du nom de la combinaison. Deux combinaisons qui entraînent la
+// même chose reçoivent la même graine, donc la même empreinte.
+static uint64_t sweep_trial_seed(const SweepContext *sweep, uint64_t config_fingerprint, int trial) {
+    uint64_t seed = hash_fnv1a(sweep->base_seed ^ config_fingerprint, &trial, sizeof(trial));
+    return seed ? seed : 1;
+}
+
+// Choix d'architecture selon l'optimiseur et l'activation : 6 architectures différentes
+static int sweep_arch_variant(const SweepContext *sweep, int o, int a) {
+    return (o * sweep->num_activations + a) % 6;
+}
+
+// Tailles et activations des couches d'une variante ; retourne le nombre de couches
+static int sweep_architecture(int arch_variant, const char *activation,
+                              size_t *layer_sizes, const char **layer_activations) {
+    switch(arch_variant) {
+        case 0: // Architecture optimisée minimaliste
+            layer_sizes[0] = 8;   // 8 features médicales
+            layer_sizes[1] = 128; // 64 → 128 (doublé)
+            layer_sizes[2] = 64;  // Ajout d'une couche
+            layer_sizes[3] = 1;   // Classification binaire
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = "sigmoid";
+            return 4; // 3 → 4 couches
+            
+        case 1: // Architecture équilibrée optimisée
+            layer_sizes[0] = 8;
+            layer_sizes[1] = 256; // 128 → 256
+            layer_sizes[2] = 128; // 64 → 128
+            layer_sizes[3] = 64;  // Ajout d'une couche
+            layer_sizes[4] = 1;
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = activation;
+            layer_activations[3] = "sigmoid";
+            return 5; // 4 → 5 couches
+            
+        case 2: // Architecture large optimisée
+            layer_sizes[0] = 8;
+            layer_sizes[1] = 512; // 256 → 512
+            layer_sizes[2] = 256; // 128 → 256
+            layer_sizes[3] = 128; // Ajout d'une couche
+            layer_sizes[4] = 1;
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = activation;
+            layer_activations[3] = "sigmoid";
+            return 5; // 4 → 5 couches
+            
+        case 3: // Architecture profonde ultra-optimisée
+            layer_sizes[0] = 8;
+            layer_sizes[1] = 256; // 128 → 256
+            layer_sizes[2] = 128; // 64 → 128
+            layer_sizes[3] = 64;  // 32 → 64
+            layer_sizes[4] = 1;
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = activation;
+            layer_activations[3] = "sigmoid";
+            return 5;
+            
+        case 4: // Architecture étroite mais plus profonde
+            layer_sizes[0] = 8;
+            layer_sizes[1] = 64;  // 32 → 64
+            layer_sizes[2] = 32;  // 16 → 32
+            layer_sizes[3] = 16;  // Ajout d'une couche
+            layer_sizes[4] = 1;
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = activation;
+            layer_activations[3] = "sigmoid";
+            return 5; // 4 → 5 couches
+            
+        default: // Architecture très large ultra-optimisée (cas 5)
+            layer_sizes[0] = 8;
+            layer_sizes[1] = 1024; // 512 → 1024
+            layer_sizes[2] = 512;  // 256 → 512
+            layer_sizes[3] = 256;  // Ajout d'une couche
+            layer_sizes[4] = 1;
+            layer_activations[0] = activation;
+            layer_activations[1] = activation;
+            layer_activations[2] = activation;
+            layer_activations[3] = "sigmoid";
+            return 5; // 4 → 5 couches
+    }
+    
+}
+
+// Coût estimé d'un essai en FLOPs, pour l'ordonnancement : 2 FLOPs par poids en
+// propagation avant, 4 en rétropropagation, sur 2 passes par époque, plus les
+// mises à jour de l'optimiseur et les évaluations. Borné par max_epochs : les
+// arrêts précoces sont rattrapés par les durées mesurées.
+#define SWEEP_UPDATE_FLOPS_PER_WEIGHT 10.0
+static double sweep_trial_flops(const SweepContext *sweep, size_t task) {
+    int combination = (int)(task / sweep->trials);
+    int o = (combination / sweep->num_activations) % sweep->num_optimizers;
+    int a = combination % sweep->num_activations;
+    size_t layer_sizes[5];
+    const char *layer_activations[4];
+    int num_layers = sweep_architecture(sweep_arch_variant(sweep, o, a), sweep->activations[a],
+                                        layer_sizes, layer_activations);
+    
+    double weights = 0.0;
+    for (int l = 0; l + 1 < num_layers; l++)
+        weights += (double)layer_sizes[l] * (double)layer_sizes[l + 1];
+    
+    double train_samples = (double)sweep->train_set->num_samples;
+    double batch = sweep->config->batch_size > 1 ? (double)sweep->config->batch_size : 1.0;
+    double updates = ceil(train_samples / batch);
+    double epoch_flops = 2.0 * (6.0 * weights * train_samples + SWEEP_UPDATE_FLOPS_PER_WEIGHT * weights * updates);
+    double evaluations = sweep->config->early_stopping ? sweep->max_epochs : sweep->max_epochs / 5 + 1;
+    double eval_flops = evaluations * 2.0 * weights * (double)sweep->test_set->num_samples;
+    return sweep->max_epochs * epoch_flops + eval_flops;
+}
+
+// Tout ce qui détermine l'entraînement d'un essai
+typedef struct {
+    int m, o, a;
+    int trial;
+    int arch_variant;
+    int num_layers;
+    size_t layer_sizes[5];
+    const char *layer_activations[4];
+    float lr;
+    float class_weights[2];     // Poids de la méthode : affichés seulement, le réseau garde {1, 1}
+    uint64_t seed;
+    uint64_t fingerprint;       // Architecture, activations, lr, poids de classes, optimiseur, budget, graine
+} TrialSetup;
+
+// Learning rate adaptatif selon l'optimiseur ET l'architecture (OPTIMISÉ POUR >95% ACCURACY!)
+static float sweep_trial_lr(const char *optimizer, int arch_variant, const char *activation) {
+    float lr = 0.003f; // 🔧 CORRECTION: Base réduite de 0.01 à 0.003 (comme version qui fonctionnait)
+    
+    // Ajustement selon l'optimiseur (OPTIMISÉ)
+    if (strcmp(optimizer, "sgd") == 0) lr = 0.015f;        // 0.05 → 0.015
+    else if (strcmp(optimizer, "lion") == 0) lr = 0.0003f; // 0.001 → 0.0003
+    else if (strcmp(optimizer, "adamw") == 0) lr = 0.005f; // 0.015 → 0.005
+    else if (strcmp(optimizer, "adam") == 0) lr = 0.004f;  // 0.012 → 0.004
+    else if (strcmp(optimizer, "rmsprop") == 0) lr = 0.002f; // 0.008 → 0.002
+    else if (strcmp(optimizer, "adabelief") == 0) lr = 0.003f; // 0.01 → 0.003
+    else if (strcmp(optimizer, "radam") == 0) lr = 0.0035f;   // 0.01 → 0.0035
+    else if (strcmp(optimizer, "adamax") == 0) lr = 0.006f;   // 0.018 → 0.006
+    else if (strcmp(optimizer, "nadam") == 0) lr = 0.0045f;   // 0.013 → 0.0045
+    
+    // Ajustement selon l'architecture pour plus de variation (OPTIMISÉ)
+    switch(arch_variant) {
+        case 0: lr *= 1.2f; break;  // Architecture minimaliste - moins agressif (1.5 → 1.2)
+        case 1: lr *= 1.0f; break;  // Architecture équilibrée - standard
+        case 2: lr *= 0.9f; break;  // Architecture large - un peu plus conservateur (0.8 → 0.9)
+        case 3: lr *= 0.7f; break;  // Architecture profonde - conservateur (0.6 → 0.7)
+        case 4: lr *= 1.3f; break;  // Architecture étroite - modérément agressif (2.0 → 1.3)
+        case 5: lr *= 0.5f; break;  // Architecture très large - très conservateur (0.4 → 0.5)
+    }
+    
+    // Ajustement selon la fonction d'activation (OPTIMISÉ)
+    if (strcmp(activation, "relu") == 0) lr *= 1.0f;        // 1.1 → 1.0
+    else if (strcmp(activation, "gelu") == 0) lr *= 0.95f;   // 0.9 → 0.95
+    else if (strcmp(activation, "sigmoid") == 0) lr *= 1.1f; // 1.3 → 1.1
+    else if (strcmp(activation, "neuroplast") == 0) lr *= 0.9f; // 0.8 → 0.9
+    else if (strcmp(activation, "mish") == 0) lr *= 0.9f;    // 0.85 → 0.9
+    else if (strcmp(activation, "swish") == 0) lr *= 1.0f;   // 0.95 → 1.0
+    return lr;
+}
+
+// Class weights adaptatifs selon la méthode neuroplast (OPTIMISÉ POUR >95%)
+static void sweep_method_class_weights(const char *method, float *class_weights) {
+    class_weights[0] = 1.0f; class_weights[1] = 1.0f; // Équilibré par défaut
+    if (strcmp(method, "adaptive") == 0) {
+        class_weights[0] = 0.85f; class_weights[1] = 1.15f; // 0.8/1.2 → 0.85/1.15
+    } else if (strcmp(method, "bayesian") == 0) {
+        class_weights[0] = 0.95f; class_weights[1] = 1.05f; // 0.9/1.1 → 0.95/1.05
+    } else if (strcmp(method, "swarm") == 0) {
+        class_weights[0] = 1.05f; class_weights[1] = 0.95f; // 1.1/0.9 → 1.05/0.95
+    } else if (strcmp(method, "advanced") == 0) {
+        class_weights[0] = 0.9f; class_weights[1] = 1.1f;   // Nouveau
+    } else if (strcmp(method, "progressive") == 0) {
+        class_weights[0] = 1.02f; class_weights[1] = 0.98f; // Nouveau
+    } else if (strcmp(method, "propagation") == 0) {
+        class_weights[0] = 0.98f; class_weights[1] = 1.02f; // Nouveau
+    }
+}
+
+static uint64_t hash_string(uint64_t h, const char *text) {
+    return hash_fnv1a(h, text, strlen(text) + 1);
+}
+
+// Configuration d'un essai et son empreinte canonique : uniquement ce qui
+// atteint les noyaux d'entraînement, jamais le nom de la méthode
+static void sweep_trial_setup(const SweepContext *sweep, size_t task, TrialSetup *setup) {
+    int combination = (int)(task / sweep->trials);
+    setup->trial = (int)(task % sweep->trials);
+    setup->m = combination / (sweep->num_optimizers * sweep->num_activations);
+    setup->o = (combination / sweep->num_activations) % sweep->num_optimizers;
+    setup->a = combination % sweep->num_activations;
+    
+    const char *optimizer = sweep->optimizers[setup->o];
+    const char *activation = sweep->activations[setup->a];
+    setup->arch_variant = sweep_arch_variant(sweep, setup->o, setup->a);
+    setup->num_layers = sweep_architecture(setup->arch_variant, activation,
+                                           setup->layer_sizes, setup->layer_activations);
+    setup->lr = sweep_trial_lr(optimizer, setup->arch_variant, activation);
+    sweep_method_class_weights(sweep->neuroplast_methods[setup->m], setup->class_weights);
+    
+    // Poids de classes réellement utilisés par l'entraînement : ceux du réseau créé
+    const float train_class_weights[2] = { 1.0f, 1.0f };
+    const RichConfig *config = sweep->config;
+    
+    uint64_t h = 0;
+    h = hash_fnv1a(h, &setup->num_layers, sizeof(setup->num_layers));
+    h = hash_fnv1a(h, setup->layer_sizes, setup->num_layers * sizeof(size_t));
+    for (int l = 0; l + 1 < setup->num_layers; l++)
+        h = hash_string(h, setup->layer_activations[l]);
+    h = hash_fnv1a(h, &setup->lr, sizeof(setup->lr));
+    h = hash_fnv1a(h, train_class_weights, sizeof(train_class_weights));
+    h = hash_string(h, optimizer);
+    h = hash_fnv1a(h, &sweep->max_epochs, sizeof(sweep->max_epochs));
+    h = hash_fnv1a(h, &config->batch_size, sizeof(config->batch_size));
+    h = hash_fnv1a(h, &config->early_stopping, sizeof(config->early_stopping));
+    h = hash_fnv1a(h, &config->patience, sizeof(config->patience));
+    
+    setup->seed = sweep_trial_seed(sweep, h, setup->trial);
+    setup->fingerprint = hash_fnv1a(h, &setup->seed, sizeof(setup->seed));
+}
+
+// Quantile 97,5% de la loi de Student à df degrés de liberté (intervalle bilatéral à 95%)
+static double student_t95(int df) {
+    static const double t95[30] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (df < 1) return 0.0;
+    return df <= 30 ? t95[df - 1] : 1.960;
+}
+
+// Moyennes et maxima pris dans l'ordre des essais : même résultat quel que soit --jobs
+static void sweep_aggregate_combination(SweepContext *sweep, int c) {
+    int m = c / (sweep->num_optimizers * sweep->num_activations);
+    int o = (c / sweep->num_activations) % sweep->num_optimizers;
+    int a = c % sweep->num_activations;
+    int trials = sweep->trials_done[c];
+    const TrialOutcome *outcomes = sweep->outcomes + (size_t)c * sweep->trials;
+    CombinationResult *r = &sweep->results[c];
+    
+    AllMetrics total_metrics = {0};  // Somme de toutes les métriques
+    AllMetrics best_metrics = {0};   // Meilleures métriques obtenues
+    int convergence_count = 0;
+    int unhealthy_trials = 0;
+    for (int t = 0; t < trials; t++) {
+        const AllMetrics *trial_best_metrics = &outcomes[t].best;
+        total_metrics.accuracy += trial_best_metrics->accuracy;
+        total_metrics.precision += trial_best_metrics->precision;
+        total_metrics.recall += trial_best_metrics->recall;
+        total_metrics.f1_score += trial_best_metrics->f1_score;
+        total_metrics.auc_roc += trial_best_metrics->auc_roc;
+        
+        if (trial_best_metrics->accuracy > best_metrics.accuracy) best_metrics.accuracy = trial_best_metrics->accuracy;
+        if (trial_best_metrics->precision > best_metrics.precision) best_metrics.precision = trial_best_metrics->precision;
+        if (trial_best_metrics->recall > best_metrics.recall) best_metrics.recall = trial_best_metrics->recall;
+        if (trial_best_metrics->f1_score > best_metrics.f1_score) best_metrics.f1_score = trial_best_metrics->f1_score;
+        if (trial_best_metrics->auc_roc > best_metrics.auc_roc) best_metrics.auc_roc = trial_best_metrics->auc_roc;
+        
+        if (outcomes[t].converged) convergence_count++;
+        if (outcomes[t].health != HEALTH_OK) unhealthy_trials++;
+    }
+    
+    snprintf(r->method, sizeof(r->method), "%s", sweep->neuroplast_methods[m]);
+    snprintf(r->optimizer, sizeof(r->optimizer), "%s", sweep->optimizers[o]);
+    snprintf(r->activation, sizeof(r->activation), "%s", sweep->activations[a]);
+    snprintf(r->full_name, sizeof(r->full_name), "%s+%s+%s",
+             sweep->neuroplast_methods[m], sweep->optimizers[o], sweep->activations[a]);
+    
+    r->avg_accuracy = total_metrics.accuracy / trials;
+    r->avg_precision = total_metrics.precision / trials;
+    r->avg_recall = total_metrics.recall / trials;
+    r->avg_f1_score = total_metrics.f1_score / trials;
+    r->avg_auc_roc = total_metrics.auc_roc / trials;
+    
+    r->best_accuracy = best_metrics.accuracy;
+    r->best_precision = best_metrics.precision;
+    r->best_recall = best_metrics.recall;
+    r->best_f1_score = best_metrics.f1_score;
+    r->best_auc_roc = best_metrics.auc_roc;
+    r->convergence_count = convergence_count;
+    r->total_trials = trials;
+    r->convergence_rate = (float)convergence_count / trials;
+    r->unhealthy_trials = unhealthy_trials;
+    r->rung = sweep->rung;
+    r->rung_epochs = sweep->max_epochs;
+    
+    double variance = 0.0;
+    for (int t = 0; t < trials; t++) {
+        double deviation = outcomes[t].best.f1_score - r->avg_f1_score;
+        variance += deviation * deviation;
+    }
+    r->f1_ci95 = trials > 1
+        ? (float)(student_t95(trials - 1) * sqrt(variance / (trials - 1) / trials))
+        : 0.0f;
+}
+
+// Ordre du classement final : palier le plus haut d'abord, puis F1 moyen
+static int combination_ranks_before(const CombinationResult *a, const CombinationResult *b) {
+    if (a->rung != b->rung) return a->rung > b->rung;
+    return a->avg_f1_score > b->avg_f1_score;
+}
+
+// Fin d'un essai (depuis n'importe quel thread) : enregistrement, affichage et
+// agrégation de la combinaison quand son dernier essai se termine. Le résultat
+// vaut aussi pour les alias de l'essai (même empreinte d'entraînement).
+static void sweep_trial_done(SweepContext *sweep, size_t task, const TrialOutcome *outcome) {
+    int trials = sweep->trials;
+    int trial = (int)(task % trials);
+    
+    pthread_mutex_lock(&sweep->lock);
+    for (size_t t = task; t != SWEEP_NO_ALIAS; t = sweep->next_alias[t]) {
+        int c = (int)(t / trials);
+        int alias = t != task;
+        sweep->outcomes[t] = *outcome;
+        if (!alias) {
+            sweep->health_counts[outcome->health]++;
+            sweep->health_restarts += outcome->restarts;
+            if (outcome->health != HEALTH_OK) sweep->health_epochs_saved += sweep->max_epochs - outcome->epochs_run;
+        }
+        
+        if (!sweep->compact && !alias) {
+            // AFFICHAGE ORGANISÉ DU RÉSUMÉ D'ESSAI
+            progress_display_trial_summary(trial, trials, outcome->best.accuracy,
+                                          outcome->best.f1_score, outcome->convergence_epoch);
+            float trial_loss = (outcome->best.f1_score > 0) ? (1.0f - outcome->best.f1_score) : outcome->final_loss;
+            progress_global_update(sweep->trials_bar, trial + 1, trial_loss, outcome->best.f1_score, outcome->lr);
+        }
+        
+        if (++sweep->trials_done[c] < sweep->trials_planned[c]) continue;
+        
+        sweep_aggregate_combination(sweep, c);
+        if (sweep->sequential) continue;   // Affichée quand ses essais s'arrêtent
+        sweep->combinations_done++;
+        const CombinationResult *r = &sweep->results[c];
+        float avg_loss = (r->avg_f1_score > 0) ? (1.0f - r->avg_f1_score) : 1.0f;
+        
+        if (sweep->compact) {
+            int canonical = (int)(task / trials);
+            char same_as[80] = "";
+            if (c != canonical)
+                snprintf(same_as, sizeof(same_as), " (= %s)",
+                         sweep->neuroplast_methods[canonical / (sweep->num_optimizers * sweep->num_activations)]);
+            printf("✅ [%d/%d] %-36s F1 moy=%.1f%% | meilleur=%.1f%% | convergence %d/%d%s\n",
+                   sweep->combinations_done, sweep->num_active, r->full_name,
+                   r->avg_f1_score * 100, r->best_f1_score * 100, r->convergence_count, trials, same_as);
+        } else if (alias) {
+            // Combinaison entièrement reprise d'une autre : barre générale seulement
+            progress_global_update(sweep->general_bar, c + 1, avg_loss, r->avg_f1_score, 0.001f);
+        } else {
+            // AFFICHAGE ORGANISÉ DU RÉSUMÉ DE COMBINAISON
+            progress_display_combination_summary(r->avg_f1_score, r->best_f1_score,
+                                               r->convergence_count, trials);
+            progress_global_update(sweep->general_bar, c + 1, avg_loss, r->avg_f1_score, 0.001f);
+            progress_prepare_next_combination();
+        }
+    }
+    pthread_mutex_unlock(&sweep->lock);
+}
+
+// Essai déjà terminé par un balayage interrompu (journal de --resume), ou NULL
+static const JournalTrial *sweep_journaled_trial(const SweepContext *sweep, const TrialSetup *setup) {
+    if (!sweep->journal) return NULL;
+    return sweep_journal_find(sweep->journal, sweep->neuroplast_methods[setup->m], sweep->optimizers[setup->o],
+                              sweep->activations[setup->a], setup->trial, sweep->max_epochs, setup->seed);
+}
+
+// Un essai complet (réseau, optimiseur et graine propres) : tâche de sweep_execute_scheduled
+static void run_sweep_trial(void *ctx, size_t task) {
+    SweepContext *sweep = ctx;
+    const char **neuroplast_methods = sweep->neuroplast_methods;
+    const char **optimizers = sweep->optimizers;
+    const char **activations = sweep->activations;
+    const RichConfig *dataset_config = sweep->config;
+    Dataset *dataset = sweep->dataset;
+    Dataset *train_set = sweep->train_set;
+    Dataset *test_set = sweep->test_set;
+    int num_activations = sweep->num_activations;
+    int max_epochs = sweep->max_epochs;
+    int compact = sweep->compact;
+    int combination = (int)(task / sweep->trials);
+    
+    TrialSetup setup;
+    sweep_trial_setup(sweep, task, &setup);
+    int trial = setup.trial;
+    int m = setup.m, o = setup.o, a = setup.a;
+    
+    TrialOutcome outcome = {0};
+    outcome.convergence_epoch = -1;
+    
+    // En série : en-tête de la combinaison avant son premier essai
+    if (!compact && trial == 0) {
+        int total_combinations = sweep->num_methods * sweep->num_optimizers * num_activations;
+        progress_display_combination_header(combination + 1, total_combinations,
+                                          neuroplast_methods[m], optimizers[o], activations[a]);
+        progress_global_update(sweep->trials_bar, 0, 0.0f, 0.0f, 0.0f);
+    }
+    
+    // Essai déjà terminé par un balayage interrompu : résultat repris du journal
+    const JournalTrial *journaled = sweep_journaled_trial(sweep, &setup);
+    if (journaled) {
+        outcome.best.accuracy = journaled->accuracy;
+        outcome.best.precision = journaled->precision;
+        outcome.best.recall = journaled->recall;
+        outcome.best.f1_score = journaled->f1_score;
+        outcome.best.auc_roc = journaled->auc_roc;
+        outcome.converged = journaled->converged;
+        outcome.convergence_epoch = journaled->convergence_epoch;
+        outcome.final_loss = journaled->final_loss;
+        outcome.lr = journaled->lr;
+        outcome.health = (HealthStatus)journaled->health;
+        outcome.restarts = journaled->restarts;
+        outcome.epochs_run = journaled->epochs_run;
+        __atomic_fetch_add(&sweep->trials_resumed, 1, __ATOMIC_RELAXED);
+        sweep_trial_done(sweep, task, &outcome);
+        return;
+    }
+    
+    // ARCHITECTURES VARIÉES selon la combinaison (NOUVEAU!)
+    size_t *layer_sizes = setup.layer_sizes;
+    int num_layers = setup.num_layers;
+    float lr = setup.lr;
+    
+    // Création du réseau avec architecture variable
+    // Graine propre à l'essai : mêmes poids quel que soit le thread ou l'ordre d'exécution
+    NeuralNetwork *network = network_create_simple_seeded(num_layers, layer_sizes, setup.layer_activations, setup.seed);
+    if (!network) {
+        print_info_safe("❌ Erreur création réseau");
+        sweep_trial_done(sweep, task, &outcome);
+        return;
+    }
+    
+    // AFFICHAGE ORGANISÉ DES INFORMATIONS DU RÉSEAU
+    char architecture[128];
+    snprintf(architecture, sizeof(architecture), "Input(%zu)", layer_sizes[0]);
+    for (int i = 1; i < num_layers; i++) {
+        char layer_str[32];
+        snprintf(layer_str, sizeof(layer_str), "→%zu", layer_sizes[i]);
+        strcat(architecture, layer_str);
+    }
+    
+    char dataset_info[128];
+    // Utiliser le nom du dataset depuis la configuration ou un nom générique
+    const char *dataset_display_name = "Dataset";
+    if (strlen(dataset_config->dataset_name) > 0) {
+        dataset_display_name = dataset_config->dataset_name;
+    }
+    snprintf(dataset_info, sizeof(dataset_info), "%s (%zu échantillons)", dataset_display_name, dataset->num_samples);
+    
+    if (!compact) progress_display_network_info(architecture, dataset_info, lr, setup.class_weights);
+    
+    // Optimiseur réel de la combinaison, appliqué sur l'arène de paramètres
+    void *optimizer_state = attach_named_optimizer(network, optimizers[o], lr);
+    
+    AllMetrics trial_best_metrics = {0};  // Meilleures métriques pour cet essai
+    int trial_convergence = 0;
+    int convergence_epoch = -1;  // Époque de convergence pour cet essai
+    float current_loss = 1.0f;
+    
+    // 🔧 CORRECTION MAJEURE: Variables pour early stopping (DÉPLACÉES HORS DE LA BOUCLE)
+    float best_f1_score = 0.0f;
+    int patience_counter = 0;
+    
+    // Surveillance de santé : un essai perdu (NaN, saturation, unités mortes, loss
+    // immobile) est redémarré avec une autre graine ou abandonné sans finir ses époques
+    HealthMonitor monitor;
+    health_monitor_init(&monitor, dataset_config, network, train_set->inputs, train_set->num_samples);
+    int restarts = 0;
+    int epochs_run = 0;
+    
+    // Réinitialiser la barre des époques pour cet essai
+    if (!compact) progress_global_update(sweep->epochs_bar, 0, 0.0f, 0.0f, 0.0f);
+    
+    // Entraînement avec affichage des métriques toutes les 5 époques
+    for (int epoch = 0; epoch < max_epochs; epoch++) {
+        current_loss = 0.0f;
+        int should_stop_early = 0;
+        
+        // Entraînement sur tout le dataset d'entraînement (MULTI-PASS POUR OPTIMISATION)
+        for (int pass = 0; pass < 2; pass++) { // 2 passages par époque pour meilleur apprentissage
+            // Mode mini-batch : une mise à jour par lot de batch_size échantillons
+            if (dataset_config->batch_size > 1) {
+                size_t batch = (size_t)dataset_config->batch_size;
+                for (size_t i = 0; i < train_set->num_samples; i += batch) {
+                    size_t count = (train_set->num_samples - i < batch) ? train_set->num_samples - i : batch;
+                    float batch_loss = network_train_batch_simple(network, &train_set->inputs[i],
+                                                                  &train_set->outputs[i], count, lr);
+                    if (pass == 0) current_loss += batch_loss;
+                }
+                continue;
+            }
+            
+            for (size_t i = 0; i < train_set->num_samples; i++) {
+                // ENTRAÎNEMENT POUR TOUTES LES MÉTHODES NEUROPLAST
+                network_forward_simple(network, train_set->inputs[i]);
+                network_backward_simple(network, train_set->inputs[i], train_set->outputs[i], lr);
+                
+                // 🔧 CORRECTION: Revenir au calcul MSE qui fonctionnait (seulement au premier passage)
+                if (pass == 0) {
+                    float *output = network_output_simple(network);
+                    if (output) {
+                        float error = output[0] - train_set->outputs[i][0];
+                        current_loss += error * error;
+                    }
+                }
+            }
+        }
+        
+        // Normaliser le loss par le nombre d'échantillons
+        current_loss = current_loss / train_set->num_samples;
+        epochs_run = epoch + 1;
+        HealthStatus health = health_monitor_epoch(&monitor, epoch, current_loss);
+        
+        // Calcul des métriques toutes les 5 époques OU si early stopping activé
+        if (epoch % 5 == 0 || epoch == max_epochs - 1 || dataset_config->early_stopping) {
+            AllMetrics test_metrics = compute_all_metrics(network, test_set, dataset_config, 0);
+            health = health_monitor_scores(&monitor, epoch, test_metrics.score_min, test_metrics.score_max,
+                                           test_metrics.nonfinite_scores);
+            
+            // Mettre à jour les meilleures métriques pour cet essai
+            if (test_metrics.f1_score > trial_best_metrics.f1_score) {
+                trial_best_metrics = test_metrics;
+            }
+            
+            // 🔧 EARLY STOPPING SIMPLIFIÉ (comme dans la version qui fonctionnait)
+            if (dataset_config->early_stopping && epoch > 10) { // Attendre au moins 10 époques
+                if (test_metrics.f1_score > best_f1_score + 0.01f) { // Amélioration significative
+                    best_f1_score = test_metrics.f1_score;
+                    patience_counter = 0;
+                } else {
+                    patience_counter++;
+                    if (patience_counter >= dataset_config->patience && best_f1_score > 0.1f) {
+                        should_stop_early = 1;
+                        printf("🛑 Early stopping à l'époque %d (patience: %d, meilleur F1: %.3f)\n", 
+                               epoch, dataset_config->patience, best_f1_score);
+                    }
+                }
+            }
+            
+            if (test_metrics.f1_score >= 0.90f && !trial_convergence) { // Convergence à 90% F1
+                trial_convergence = 1;
+                convergence_epoch = epoch;
+            }
+            
+            // AFFICHAGE ORGANISÉ DES INFORMATIONS D'ÉPOQUE
+            if (!compact && (epoch % 5 == 0 || epoch == max_epochs - 1)) {
+                progress_display_epoch_info(epoch, max_epochs, current_loss, 
+                                           test_metrics.accuracy, test_metrics.precision,
+                                           test_metrics.recall, test_metrics.f1_score);
+            }
+            
+            // Mettre à jour la barre des époques avec métriques toutes les 5 époques
+            if (!compact) progress_global_update(sweep->epochs_bar, epoch + 1, current_loss, test_metrics.f1_score, lr);
+        }
+        
+        // Loss immobile après la convergence ou l'early stopping : fin normale, pas un échec
+        if (trial_convergence || should_stop_early) health = health_monitor_converged(&monitor);
+        
+        if (health != HEALTH_OK) {
+            char health_info[160];
+            if (health_status_restartable(health) && restarts < dataset_config->health_max_restarts) {
+                // Réseau perdu : nouveau tirage des poids, budget d'époques complet
+                restarts++;
+                uint64_t restart_seed = hash_fnv1a(setup.seed, &restarts, sizeof(restarts));
+                NeuralNetwork *restarted = network_create_simple_seeded(num_layers, layer_sizes,
+                                                                        setup.layer_activations, restart_seed);
+                if (restarted) {
+                    snprintf(health_info, sizeof(health_info), "🩺 Essai %d redémarré (%s à l'époque %d)",
+                             trial + 1, health_status_name(health), epoch);
+                    if (!compact) print_info_safe(health_info);
+                    network_free_simple(network);
+                    trainer_free_optimizer_state(optimizers[o], optimizer_state);
+                    network = restarted;
+                    optimizer_state = attach_named_optimizer(network, optimizers[o], lr);
+                    health_monitor_restart(&monitor, network);
+                    trial_best_metrics = (AllMetrics){0};
+                    trial_convergence = 0;
+                    convergence_epoch = -1;
+                    best_f1_score = 0.0f;
+                    patience_counter = 0;
+                    epoch = -1;   // La boucle reprend à l'époque 0
+                    continue;
+                }
+            }
+            snprintf(health_info, sizeof(health_info), "🩺 Essai %d abandonné (%s à l'époque %d)",
+                     trial + 1, health_status_name(health), epoch);
+            if (!compact) print_info_safe(health_info);
+            break;
+        }
+        
+        // Early stopping pour éviter l'overfitting (simplifié)
+        if (should_stop_early || (trial_convergence && epoch > max_epochs / 3)) {
+            if (should_stop_early) {
+                print_info_safe("🛑 Arrêt précoce par early stopping");
+            } else {
+                print_info_safe("✅ Convergence précoce détectée");
+            }
+            break;
+        }
+    }
+    
+    // 🎯 ÉVALUER ET SAUVEGARDER LE MODÈLE AVEC NOTRE SYSTÈME INTÉGRÉ
+    // Calculer les métriques finales pour la sauvegarde
+    AllMetrics final_metrics = compute_all_metrics(network, test_set, dataset_config, 1);
+    AllMetrics train_metrics = compute_all_metrics(network, train_set, dataset_config, 1);
+    
+    // Ajouter ce modèle aux candidats pour le top 10, une fois par alias : les
+    // combinaisons de même empreinte ont entraîné exactement ce réseau
+    for (size_t t = task; t != SWEEP_NO_ALIAS; t = sweep->next_alias[t]) {
+        int c = (int)(t / sweep->trials);
+        const char *method = neuroplast_methods[c / (sweep->num_optimizers * num_activations)];
+        const char *optimizer = optimizers[(c / num_activations) % sweep->num_optimizers];
+        const char *activation = activations[c % num_activations];
+        char model_name[128];
+        snprintf(model_name, sizeof(model_name), "%s+%s+%s", method, optimizer, activation);
+        
+        int save_result = add_candidate_model(
+            model_name,
+            optimizer,
+            method,
+            activation,
+            train_metrics.accuracy,
+            current_loss,
+            final_metrics.accuracy,
+            1.0f - final_metrics.f1_score, // Approximation de la validation loss
+            final_metrics.f1_score,
+            lr,
+            (c + 1) * 1000 + trial
+        );
+        
+        if (save_result == 1) {
+            char save_info[256];
+            snprintf(save_info, sizeof(save_info), 
+                    "🏆 Modèle %s ajouté au TOP 10! F1=%.1f%% Acc=%.1f%%", 
+                    model_name, 
+                    final_metrics.f1_score * 100, 
+                    final_metrics.accuracy * 100);
+            print_info_safe(save_info);
+        }
+    }
+    
+    outcome.best = trial_best_metrics;
+    outcome.converged = trial_convergence;
+    outcome.convergence_epoch = convergence_epoch;
+    outcome.final_loss = current_loss;
+    outcome.lr = lr;
+    outcome.health = monitor.status;
+    outcome.restarts = restarts;
+    outcome.epochs_run = epochs_run;
+    
+    health_monitor_free(&monitor);
+    network_free_simple(network);
+    trainer_free_optimizer_state(optimizers[o], optimizer_state);
+    
+    // Journalisé avant d'être compté : un arrêt après cette ligne ne le refait pas.
+    // Une ligne par alias, pour que l'export du journal couvre toutes les combinaisons.
+    if (sweep->journal) {
+        for (size_t t = task; t != SWEEP_NO_ALIAS; t = sweep->next_alias[t]) {
+            int c = (int)(t / sweep->trials);
+            int alias_m = c / (sweep->num_optimizers * num_activations);
+            JournalTrial entry;
+            memset(&entry, 0, sizeof(entry));
+            snprintf(entry.method, sizeof(entry.method), "%s", neuroplast_methods[alias_m]);
+            snprintf(entry.optimizer, sizeof(entry.optimizer), "%s", optimizers[(c / num_activations) % sweep->num_optimizers]);
+            snprintf(entry.activation, sizeof(entry.activation), "%s", activations[c % num_activations]);
+            entry.trial = trial;
+            entry.epochs = max_epochs;
+            entry.seed = setup.seed;
+            entry.converged = outcome.converged;
+            entry.convergence_epoch = outcome.convergence_epoch;
+            entry.final_loss = outcome.final_loss;
+            entry.lr = outcome.lr;
+            entry.accuracy = outcome.best.accuracy;
+            entry.precision = outcome.best.precision;
+            entry.recall = outcome.best.recall;
+            entry.f1_score = outcome.best.f1_score;
+            entry.auc_roc = outcome.best.auc_roc;
+            entry.health = outcome.health;
+            entry.restarts = outcome.restarts;
+            entry.epochs_run = outcome.epochs_run;
+            if (!sweep_journal_append(sweep->journal, &entry)) {
+                print_info_safe("⚠️ Écriture du journal impossible pour cet essai");
+            }
+        }
+    }
+    
+    sweep_trial_done(sweep, task, &outcome);
+}
+
+// Hash de la configuration d'un balayage : fichier YAML et données train/test
+// effectivement chargées. Un journal ne reprend que des essais de même hash.
+static uint64_t sweep_config_hash(const char *config_path, const Dataset *train_set, const Dataset *test_set) {
+    uint64_t h = hash_fnv1a(0, "neuroplast-sweep-v2", 19);
+    FILE *file = fopen(config_path, "rb");
+    if (file) {
+        unsigned char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            h = hash_fnv1a(h, buffer, n);
+        fclose(file);
+    }
+    const Dataset *sets[2] = { train_set, test_set };
+    for (int d = 0; d < 2; d++) {
+        const Dataset *set = sets[d];
+        h = hash_fnv1a(h, &set->num_samples, sizeof(set->num_samples));
+        for (size_t i = 0; i < set->num_samples; i++) {
+            h = hash_fnv1a(h, set->inputs[i], set->input_cols * sizeof(float));
+            h = hash_fnv1a(h, set->outputs[i], set->output_cols * sizeof(float));
+        }
+    }
+    return h;
+}
+
+// Essais de la prochaine vague, dans l'ordre des combinaisons : ceux qui manquent
+// à chaque combinaison active pour atteindre trials_planned. Retourne leur nombre.
+static size_t sweep_wave_tasks(SweepContext *sweep) {
+    size_t count = 0;
+    for (int i = 0; i < sweep->num_active; i++) {
+        int c = sweep->active[i];
+        for (int k = sweep->trials_done[c]; k < sweep->trials_planned[c]; k++)
+            sweep->run_tasks[count++] = (size_t)c * sweep->trials + k;
+    }
+    return count;
+}
+
+static void run_active_trial(void *ctx, size_t t) {
+    SweepContext *sweep = ctx;
+    run_sweep_trial(ctx, sweep->run_tasks[t]);
+}
+
+typedef struct {
+    uint64_t fingerprint;
+    size_t task;
+} TaskFingerprint;
+
+static int compare_task_fingerprints(const void *a, const void *b) {
+    const TaskFingerprint *x = a, *y = b;
+    if (x->fingerprint != y->fingerprint) return x->fingerprint < y->fingerprint ? -1 : 1;
+    return x->task < y->task ? -1 : x->task > y->task;
+}
+
+// Regrouper les essais de run_tasks par empreinte : le premier (ordre des
+// combinaisons) reste dans run_tasks, les suivants sont chaînés derrière lui
+// comme alias. Retourne 0 si la mémoire manque (chaque essai est alors exécuté).
+static int sweep_deduplicate_wave(SweepContext *sweep, size_t num_tasks) {
+    sweep->num_run_tasks = num_tasks;
+    for (size_t t = 0; t < num_tasks; t++) sweep->next_alias[sweep->run_tasks[t]] = SWEEP_NO_ALIAS;
+    TaskFingerprint *prints = malloc(num_tasks * sizeof(TaskFingerprint));
+    if (!prints) return 0;
+    
+    for (size_t t = 0; t < num_tasks; t++) {
+        TrialSetup setup;
+        prints[t].task = sweep->run_tasks[t];
+        sweep_trial_setup(sweep, prints[t].task, &setup);
+        prints[t].fingerprint = setup.fingerprint;
+    }
+    qsort(prints, num_tasks, sizeof(TaskFingerprint), compare_task_fingerprints);
+    
+    size_t num_run = 0;
+    for (size_t i = 0; i < num_tasks; i++) {
+        if (i > 0 && prints[i].fingerprint == prints[i - 1].fingerprint) {
+            sweep->next_alias[prints[i - 1].task] = prints[i].task;
+            sweep->trials_deduplicated++;
+        } else {
+            sweep->run_tasks[num_run++] = prints[i].task;
+        }
+    }
+    free(prints);
+    
+    // Exécution dans l'ordre des combinaisons (affichage en série, répartition des coûts)
+    for (size_t i = 1; i < num_run; i++) {
+        size_t task = sweep->run_tasks[i], j = i;
+        while (j > 0 && task < sweep->run_tasks[j - 1]) {
+            sweep->run_tasks[j] = sweep->run_tasks[j - 1];
+            j--;
+        }
+        sweep->run_tasks[j] = task;
+    }
+    sweep->num_run_tasks = num_run;
+    return 1;
+}
+
+// Durées cumulées sur tous les paliers, par architecture ; rates : secondes par
+// unité de coût mesurées, reprises par l'ordonnancement de chaque vague suivante
+typedef struct {
+    SweepScheduleStats total;
+    SweepCostRates rates;
+    double arch_seconds[6];
+    double arch_flops[6];
+    int arch_trials[6];
+} SweepTiming;
+
+// Exécuter une vague : une fois chaque empreinte d'essai, les plus coûteux d'abord
+static void sweep_run_wave(SweepContext *sweep, int jobs, SweepTiming *timing) {
+    sweep_deduplicate_wave(sweep, sweep_wave_tasks(sweep));
+    size_t num_tasks = sweep->num_run_tasks;
+    SweepTaskInfo *task_costs = calloc(num_tasks, sizeof(SweepTaskInfo));
+    if (!task_costs) {
+        sweep_execute(num_tasks, jobs, run_active_trial, sweep);
+        return;
+    }
+    
+    for (size_t t = 0; t < num_tasks; t++) {
+        size_t task = sweep->run_tasks[t];
+        int c = (int)(task / sweep->trials);
+        int o = (c / sweep->num_activations) % sweep->num_optimizers;
+        task_costs[t].estimated_cost = sweep_trial_flops(sweep, task);
+        task_costs[t].cost_class = sweep_arch_variant(sweep, o, c % sweep->num_activations);
+        // Repris du journal : quasi instantané, ne doit pas fausser les durées par unité de coût
+        TrialSetup setup;
+        sweep_trial_setup(sweep, task, &setup);
+        task_costs[t].replayed = sweep_journaled_trial(sweep, &setup) != NULL;
+    }
+    
+    SweepScheduleStats schedule;
+    sweep_execute_scheduled(num_tasks, jobs, run_active_trial, sweep, task_costs, &timing->rates, &schedule);
+    
+    timing->total.jobs = schedule.jobs;
+    timing->total.makespan_seconds += schedule.makespan_seconds;
+    timing->total.busy_seconds += schedule.busy_seconds;
+    timing->total.steals += schedule.steals;
+    for (size_t t = 0; t < num_tasks; t++) {
+        if (task_costs[t].replayed) continue;
+        int v = task_costs[t].cost_class;
+        timing->arch_seconds[v] += task_costs[t].wall_seconds;
+        timing->arch_flops[v] += task_costs[t].estimated_cost;
+        timing->arch_trials[v]++;
+    }
+    free(task_costs);
+}
+
+static int compare_floats_descending(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x < y) - (x > y);
+}
+
+// Après une vague, décider quelles combinaisons actives reçoivent un essai de
+// plus. Une combinaison s'arrête quand sa borne haute (IC 95%) reste sous la
+// borne basse de places autres combinaisons (elle ne peut plus entrer dans les
+// places disputées), quand son intervalle est assez étroit, ou au plafond
+// d'essais. Retourne le nombre de combinaisons prolongées.
+static int sweep_sequential_extend(SweepContext *sweep, int places) {
+    float threshold = -1.0f;    // Borne basse de la places-ième meilleure combinaison
+    float *lower_bounds = places < sweep->num_active ? malloc(sweep->num_active * sizeof(float)) : NULL;
+    if (lower_bounds) {
+        for (int i = 0; i < sweep->num_active; i++) {
+            const CombinationResult *r = &sweep->results[sweep->active[i]];
+            lower_bounds[i] = r->avg_f1_score - r->f1_ci95;
+        }
+        qsort(lower_bounds, sweep->num_active, sizeof(float), compare_floats_descending);
+        threshold = lower_bounds[places - 1];
+        free(lower_bounds);
+    }
+    
+    int extended = 0;
+    for (int i = 0; i < sweep->num_active; i++) {
+        int c = sweep->active[i];
+        CombinationResult *r = &sweep->results[c];
+        if (r->trials_stop != TRIALS_RUNNING) continue;
+        
+        if (r->avg_f1_score + r->f1_ci95 < threshold) {
+            r->trials_stop = TRIALS_OUT_OF_TOP;
+        } else if (r->f1_ci95 <= SEQUENTIAL_CI_HALF_WIDTH) {
+            r->trials_stop = TRIALS_PRECISE;
+        } else if (sweep->trials_done[c] >= SEQUENTIAL_MAX_TRIALS) {
+            r->trials_stop = TRIALS_CAPPED;
+        } else {
+            sweep->trials_planned[c]++;
+            extended++;
+            continue;
+        }
+        sweep->combinations_done++;
+        printf("✅ [%d/%d] %-36s F1 moy=%.1f%% ±%.1f | meilleur=%.1f%% | %2d essais (%s)\n",
+               sweep->combinations_done, sweep->num_active, r->full_name,
+               r->avg_f1_score * 100, r->f1_ci95 * 100, r->best_f1_score * 100,
+               r->total_trials, trials_stop_name(r->trials_stop));
+    }
+    return extended;
+}
+
+// Un palier : trials essais par combinaison active, ou en mode séquentiel
+// SEQUENTIAL_MIN_TRIALS essais puis des vagues d'un essai de plus pour les
+// combinaisons encore incertaines. places : combinaisons gardées à l'issue du
+// palier (promues au palier suivant, ou le TOP 10 au dernier).
+static void sweep_run_rung(SweepContext *sweep, int jobs, SweepTiming *timing, int places) {
+    sweep->combinations_done = 0;
+    for (int i = 0; i < sweep->num_active; i++) {
+        int c = sweep->active[i];
+        sweep->trials_done[c] = 0;
+        sweep->trials_planned[c] = sweep->sequential ? SEQUENTIAL_MIN_TRIALS : sweep->trials;
+        sweep->results[c].trials_stop = sweep->sequential ? TRIALS_RUNNING : TRIALS_FIXED;
+    }
+    sweep_run_wave(sweep, jobs, timing);
+    while (sweep->sequential && sweep_sequential_extend(sweep, places) > 0) {
+        sweep_run_wave(sweep, jobs, timing);
+    }
+}
+
+// Paliers : budgets max_epochs / eta^k croissants, un tiers des combinaisons
+// promu à chaque palier (au moins HYPERBAND_MIN_FINALISTS). Les paliers qui
+// n'élagueraient plus rien sont retirés. Retourne le nombre de paliers.
+static int sweep_plan_rungs(SweepSearchMode search, int max_epochs, int total_combinations,
+                            int *rung_epochs, int *rung_sizes) {
+    int max_rung = 0;
+    if (search == SWEEP_SEARCH_HYPERBAND) {
+        int budget = max_epochs;
+        while (max_rung + 1 < HYPERBAND_MAX_RUNGS && budget / HYPERBAND_ETA >= HYPERBAND_MIN_EPOCHS) {
+            budget /= HYPERBAND_ETA;
+            max_rung++;
+        }
+    }
+    
+    for (;; max_rung--) {
+        rung_sizes[0] = total_combinations;
+        for (int r = 1; r <= max_rung; r++) {
+            int promoted = (rung_sizes[r - 1] + HYPERBAND_ETA - 1) / HYPERBAND_ETA;
+            int floor = rung_sizes[r - 1] < HYPERBAND_MIN_FINALISTS ? rung_sizes[r - 1] : HYPERBAND_MIN_FINALISTS;
+            rung_sizes[r] = promoted > floor ? promoted : floor;
+        }
+        if (max_rung == 0 || rung_sizes[max_rung] < rung_sizes[max_rung - 1]) break;
+    }
+    
+    int divisor = 1;
+    for (int r = max_rung; r >= 0; r--) {
+        rung_epochs[r] = max_epochs / divisor > 0 ? max_epochs / divisor : 1;
+        divisor *= HYPERBAND_ETA;
+    }
+    return max_rung + 1;
+}
+
+// Garder les promoted meilleures combinaisons actives (F1 moyen du palier,
+// ex aequo départagés par l'ordre des combinaisons), rangées par numéro
+static void sweep_promote(SweepContext *sweep, int *active, int promoted) {
+    for (int i = 1; i < sweep->num_active; i++) {
+        int c = active[i], j = i;
+        while (j > 0 && sweep->results[c].avg_f1_score > sweep->results[active[j - 1]].avg_f1_score) {
+            active[j] = active[j - 1];
+            j--;
+        }
+        active[j] = c;
+    }
+    for (int i = 1; i < promoted; i++) {
+        int c = active[i], j = i;
+        while (j > 0 && c < active[j - 1]) {
+            active[j] = active[j - 1];
+            j--;
+        }
+        active[j] = c;
+    }
+}
+
 // Test exhaustif avec dataset réel (appelé depuis main pour compare_all_methods)
 int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
                                const char **optimizers, int num_optimizers,
                                const char **activations, int num_activations,
-                               const char *config_path, int max_epochs) {
+                               const char *config_path, int max_epochs,
+                               const SweepOptions *options) {
+    int jobs = options->jobs;
+    SweepSearchMode search = options->search;
+    int sequential = options->sequential;
     printf("🚀 TEST EXHAUSTIF AVEC DATASET RÉEL\n");
     printf("=====================================\n\n");
     
@@ -1115,8 +2254,22 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     printf("   🚀 %d combinaisons TOTALES\n", total_combinations);
     printf("   🔄 3 essais par combinaison\n");
     printf("   📈 %d époques max par essai\n\n", max_epochs);
+    if (search == SWEEP_SEARCH_HYPERBAND) {
+        printf("✂️ Recherche par paliers (--search hyperband) : budget d'époques multiplié par %d\n", HYPERBAND_ETA);
+        printf("   à chaque palier, seul le meilleur tiers des combinaisons (F1 de validation) est promu\n\n");
+    }
+    if (sequential) {
+        printf("📐 Essais séquentiels (--sequential) : %d à %d essais par combinaison, arrêt dès que\n",
+               SEQUENTIAL_MIN_TRIALS, SEQUENTIAL_MAX_TRIALS);
+        printf("   l'IC 95%% du F1 moyen fait moins de ±%.0f point ou exclut le TOP %d\n\n",
+               SEQUENTIAL_CI_HALF_WIDTH * 100, SEQUENTIAL_TOP_K);
+    }
     
-    printf("⏱️ Durée estimée : 45-60 minutes (mode exhaustif avec dataset réel)\n");
+    if (jobs > 1) {
+        printf("⏱️ Durée estimée : 45-60 minutes sur un cœur, divisée par ~%d (--jobs %d)\n", jobs, jobs);
+    } else {
+        printf("⏱️ Durée estimée : 45-60 minutes (mode exhaustif avec dataset réel)\n");
+    }
     printf("📊 Architecture : Input→256→128→Output\n");
     printf("🎯 Dataset : %s\n\n", config_path);
     
@@ -1175,432 +2328,182 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
         printf("💾 Sauvegarde automatique des 10 meilleurs modèles activée\n");
     }
     
-    // Initialiser le système d'affichage dual zone (NOUVELLE APPROCHE)
-    progress_init_dual_zone(
-        "Test exhaustif avec dataset réel - 3 essais par combinaison", 
-        total_combinations,
-        3,  // 3 essais par combinaison
-        max_epochs  // époques max par essai
-    );
-    
-    // Créer les barres de progression hiérarchiques
-    int general_bar = progress_global_add(PROGRESS_GENERAL, "Test Exhaustif Complet", total_combinations, 40);
-    int trials_bar = progress_global_add(PROGRESS_TRIALS, "Essais par Combinaison", 3, 25);
-    int epochs_bar = progress_global_add(PROGRESS_EPOCHS, "Epoques par Essai", max_epochs, 20);
+    // 📓 JOURNAL DES ESSAIS : chaque essai terminé est écrit et synchronisé sur
+    // disque, un balayage relancé avec --resume saute les essais déjà faits
+    char journal_path[512];
+    if (options->journal_path) {
+        snprintf(journal_path, sizeof(journal_path), "%s", options->journal_path);
+    } else {
+        snprintf(journal_path, sizeof(journal_path), "sweep_journal_%s.log", dataset_name);
+    }
+    SweepJournal journal;
+    uint64_t config_hash = sweep_config_hash(config_path, train_set, test_set);
+    int journal_open = sweep_journal_open(&journal, journal_path, config_hash,
+                                          options->resume, rng_seed_from_rand());
+    if (journal_open) {
+        printf("📓 Journal des essais : %s (configuration %016llx)\n", journal_path, (unsigned long long)config_hash);
+        if (options->resume) {
+            printf("🔁 Reprise : %zu essai(s) déjà terminé(s) seront sautés\n", journal.resumed);
+        }
+    } else {
+        printf("⚠️ Journal indisponible, le balayage ne pourra pas être repris\n");
+    }
     
-    print_info_safe("🎯 Système de progression dual zone initialisé pour test exhaustif");
-    print_info_safe("📊 Zone des barres: Lignes 11-14 | Zone des infos: Ligne 19+");
+    int trials = SWEEP_TRIALS_PER_COMBINATION; // 3 → 5 essais par combinaison pour plus de stabilité
+    if (sequential) trials = SEQUENTIAL_MAX_TRIALS;
+    size_t total_trials = (size_t)total_combinations * trials;
     
     // Variables pour collecter les résultats de TOUTES les combinaisons avec toutes les métriques
-    typedef struct {
-        char method[32];
-        char optimizer[32];
-        char activation[32];
-        char full_name[128];
-        // Métriques moyennes sur tous les essais
-        float avg_accuracy;
-        float avg_precision;
-        float avg_recall;
-        float avg_f1_score;
-        float avg_auc_roc;
-        // Meilleures métriques obtenues
-        float best_accuracy;
-        float best_precision;
-        float best_recall;
-        float best_f1_score;
-        float best_auc_roc;
-        // Informations de convergence
-        int convergence_count;
-        int total_trials;
-        float convergence_rate;
-    } CombinationResult;
-    
-    CombinationResult *results = malloc(total_combinations * sizeof(CombinationResult));
-    if (!results) {
+    CombinationResult *results = calloc(total_combinations, sizeof(CombinationResult));
+    TrialOutcome *outcomes = calloc(total_trials, sizeof(TrialOutcome));
+    int *trials_done = calloc(total_combinations, sizeof(int));
+    int *trials_planned = calloc(total_combinations, sizeof(int));
+    int *active = malloc(total_combinations * sizeof(int));
+    size_t *run_tasks = malloc(total_trials * sizeof(size_t));
+    size_t *next_alias = malloc(total_trials * sizeof(size_t));
+    if (!results || !outcomes || !trials_done || !trials_planned || !active || !run_tasks || !next_alias) {
         printf("❌ Erreur allocation mémoire pour %d combinaisons\n", total_combinations);
+        free(results);
+        free(outcomes);
+        free(trials_done);
+        free(trials_planned);
+        free(active);
+        free(run_tasks);
+        free(next_alias);
+        if (journal_open) sweep_journal_close(&journal);
         dataset_free(dataset);
         dataset_free(train_set);
         dataset_free(test_set);
         return 1;
     }
     
-    int result_count = 0;
-    int combination_count = 0;
+    SweepContext sweep;
+    memset(&sweep, 0, sizeof(sweep));
+    sweep.neuroplast_methods = neuroplast_methods;
+    sweep.optimizers = optimizers;
+    sweep.activations = activations;
+    sweep.num_methods = num_methods;
+    sweep.num_optimizers = num_optimizers;
+    sweep.num_activations = num_activations;
+    sweep.trials = trials;
+    sweep.sequential = sequential;
+    sweep.max_epochs = max_epochs;
+    sweep.active = active;
+    sweep.config = &dataset_config;
+    sweep.dataset = dataset;
+    sweep.train_set = train_set;
+    sweep.test_set = test_set;
+    sweep.base_seed = journal_open ? journal.base_seed : rng_seed_from_rand();
+    sweep.journal = journal_open ? &journal : NULL;
+    sweep.compact = jobs > 1 || search == SWEEP_SEARCH_HYPERBAND || sequential;
+    sweep.outcomes = outcomes;
+    sweep.trials_done = trials_done;
+    sweep.trials_planned = trials_planned;
+    sweep.results = results;
+    sweep.run_tasks = run_tasks;
+    sweep.next_alias = next_alias;
+    pthread_mutex_init(&sweep.lock, NULL);
+    
+    if (!sweep.compact) {
+        // Initialiser le système d'affichage dual zone (NOUVELLE APPROCHE)
+        progress_init_dual_zone(
+            "Test exhaustif avec dataset réel - 3 essais par combinaison", 
+            total_combinations,
+            3,  // 3 essais par combinaison
+            max_epochs  // époques max par essai
+        );
+        
+        // Créer les barres de progression hiérarchiques
+        sweep.general_bar = progress_global_add(PROGRESS_GENERAL, "Test Exhaustif Complet", total_combinations, 40);
+        sweep.trials_bar = progress_global_add(PROGRESS_TRIALS, "Essais par Combinaison", 3, 25);
+        sweep.epochs_bar = progress_global_add(PROGRESS_EPOCHS, "Epoques par Essai", max_epochs, 20);
+        
+        print_info_safe("🎯 Système de progression dual zone initialisé pour test exhaustif");
+        print_info_safe("📊 Zone des barres: Lignes 11-14 | Zone des infos: Ligne 19+");
+    }
     
     printf("🚀 DÉMARRAGE DU TEST EXHAUSTIF AVEC DATASET RÉEL...\n\n");
+    if (jobs > 1) {
+        printf("⚡ Essais répartis sur %d threads (--jobs %d)\n\n", jobs, jobs);
+    }
     
-    // BOUCLE TRIPLE : TOUTES LES COMBINAISONS
-    for (int m = 0; m < num_methods; m++) {
-        for (int o = 0; o < num_optimizers; o++) {
-            for (int a = 0; a < num_activations; a++) {
-                combination_count++;
-                
-                // AFFICHAGE ORGANISÉ DE L'EN-TÊTE DE COMBINAISON
-                progress_display_combination_header(combination_count, total_combinations,
-                                                  neuroplast_methods[m], optimizers[o], activations[a]);
-                
-                // Variables pour moyenner sur plusieurs essais - toutes les métriques
-                AllMetrics total_metrics = {0};  // Somme de toutes les métriques
-                AllMetrics best_metrics = {0};   // Meilleures métriques obtenues
-                int convergence_count = 0;
-                int trials = 5; // 3 → 5 essais par combinaison pour plus de stabilité
-                
-                // Réinitialiser la barre des essais pour cette combinaison
-                progress_global_update(trials_bar, 0, 0.0f, 0.0f, 0.0f);
-                
-                for (int trial = 0; trial < trials; trial++) {
-                    // ARCHITECTURES VARIÉES selon la combinaison (NOUVEAU!)
-                    size_t layer_sizes[5];
-                    const char *test_activations[4];
-                    int num_layers;
-                    
-                    // Choix d'architecture selon l'optimiseur et l'activation
-                    int arch_variant = (o * num_activations + a) % 6; // 6 architectures différentes
-                    
-                    switch(arch_variant) {
-                        case 0: // Architecture optimisée minimaliste
-                            layer_sizes[0] = 8;   // 8 features médicales
-                            layer_sizes[1] = 128; // 64 → 128 (doublé)
-                            layer_sizes[2] = 64;  // Ajout d'une couche
-                            layer_sizes[3] = 1;   // Classification binaire
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = "sigmoid";
-                            num_layers = 4; // 3 → 4 couches
-                            break;
-                            
-                        case 1: // Architecture équilibrée optimisée
-                            layer_sizes[0] = 8;
-                            layer_sizes[1] = 256; // 128 → 256
-                            layer_sizes[2] = 128; // 64 → 128
-                            layer_sizes[3] = 64;  // Ajout d'une couche
-                            layer_sizes[4] = 1;
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = activations[a];
-                            test_activations[3] = "sigmoid";
-                            num_layers = 5; // 4 → 5 couches
-                            break;
-                            
-                        case 2: // Architecture large optimisée
-                            layer_sizes[0] = 8;
-                            layer_sizes[1] = 512; // 256 → 512
-                            layer_sizes[2] = 256; // 128 → 256
-                            layer_sizes[3] = 128; // Ajout d'une couche
-                            layer_sizes[4] = 1;
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = activations[a];
-                            test_activations[3] = "sigmoid";
-                            num_layers = 5; // 4 → 5 couches
-                            break;
-                            
-                        case 3: // Architecture profonde ultra-optimisée
-                            layer_sizes[0] = 8;
-                            layer_sizes[1] = 256; // 128 → 256
-                            layer_sizes[2] = 128; // 64 → 128
-                            layer_sizes[3] = 64;  // 32 → 64
-                            layer_sizes[4] = 1;
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = activations[a];
-                            test_activations[3] = "sigmoid";
-                            num_layers = 5;
-                            break;
-                            
-                        case 4: // Architecture étroite mais plus profonde
-                            layer_sizes[0] = 8;
-                            layer_sizes[1] = 64;  // 32 → 64
-                            layer_sizes[2] = 32;  // 16 → 32
-                            layer_sizes[3] = 16;  // Ajout d'une couche
-                            layer_sizes[4] = 1;
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = activations[a];
-                            test_activations[3] = "sigmoid";
-                            num_layers = 5; // 4 → 5 couches
-                            break;
-                            
-                        default: // Architecture très large ultra-optimisée (cas 5)
-                            layer_sizes[0] = 8;
-                            layer_sizes[1] = 1024; // 512 → 1024
-                            layer_sizes[2] = 512;  // 256 → 512
-                            layer_sizes[3] = 256;  // Ajout d'une couche
-                            layer_sizes[4] = 1;
-                            test_activations[0] = activations[a];
-                            test_activations[1] = activations[a];
-                            test_activations[2] = activations[a];
-                            test_activations[3] = "sigmoid";
-                            num_layers = 5; // 4 → 5 couches
-                            break;
-                    }
-                    
-                    // Création du réseau avec architecture variable
-                    NeuralNetwork *network = network_create_simple(num_layers, layer_sizes, test_activations);
-                    if (!network) {
-                        print_info_safe("❌ Erreur création réseau");
-                        continue;
-                    }
-                    
-                    // Learning rate adaptatif selon l'optimiseur ET l'architecture (OPTIMISÉ POUR >95% ACCURACY!)
-                    float lr = 0.003f; // 🔧 CORRECTION: Base réduite de 0.01 à 0.003 (comme version qui fonctionnait)
-                    
-                    // Ajustement selon l'optimiseur (OPTIMISÉ)
-                    if (strcmp(optimizers[o], "sgd") == 0) lr = 0.015f;        // 0.05 → 0.015
-                    else if (strcmp(optimizers[o], "lion") == 0) lr = 0.0003f; // 0.001 → 0.0003
-                    else if (strcmp(optimizers[o], "adamw") == 0) lr = 0.005f; // 0.015 → 0.005
-                    else if (strcmp(optimizers[o], "adam") == 0) lr = 0.004f;  // 0.012 → 0.004
-                    else if (strcmp(optimizers[o], "rmsprop") == 0) lr = 0.002f; // 0.008 → 0.002
-                    else if (strcmp(optimizers[o], "adabelief") == 0) lr = 0.003f; // 0.01 → 0.003
-                    else if (strcmp(optimizers[o], "radam") == 0) lr = 0.0035f;   // 0.01 → 0.0035
-                    else if (strcmp(optimizers[o], "adamax") == 0) lr = 0.006f;   // 0.018 → 0.006
-                    else if (strcmp(optimizers[o], "nadam") == 0) lr = 0.0045f;   // 0.013 → 0.0045
-                    
-                    // Ajustement selon l'architecture pour plus de variation (OPTIMISÉ)
-                    switch(arch_variant) {
-                        case 0: lr *= 1.2f; break;  // Architecture minimaliste - moins agressif (1.5 → 1.2)
-                        case 1: lr *= 1.0f; break;  // Architecture équilibrée - standard
-                        case 2: lr *= 0.9f; break;  // Architecture large - un peu plus conservateur (0.8 → 0.9)
-                        case 3: lr *= 0.7f; break;  // Architecture profonde - conservateur (0.6 → 0.7)
-                        case 4: lr *= 1.3f; break;  // Architecture étroite - modérément agressif (2.0 → 1.3)
-                        case 5: lr *= 0.5f; break;  // Architecture très large - très conservateur (0.4 → 0.5)
-                    }
-                    
-                    // Ajustement selon la fonction d'activation (OPTIMISÉ)
-                    if (strcmp(activations[a], "relu") == 0) lr *= 1.0f;        // 1.1 → 1.0
-                    else if (strcmp(activations[a], "gelu") == 0) lr *= 0.95f;   // 0.9 → 0.95
-                    else if (strcmp(activations[a], "sigmoid") == 0) lr *= 1.1f; // 1.3 → 1.1
-                    else if (strcmp(activations[a], "neuroplast") == 0) lr *= 0.9f; // 0.8 → 0.9
-                    else if (strcmp(activations[a], "mish") == 0) lr *= 0.9f;    // 0.85 → 0.9
-                    else if (strcmp(activations[a], "swish") == 0) lr *= 1.0f;   // 0.95 → 1.0
-                    
-                    // AFFICHAGE ORGANISÉ DES INFORMATIONS DU RÉSEAU
-                    char architecture[128];
-                    snprintf(architecture, sizeof(architecture), "Input(%zu)", layer_sizes[0]);
-                    for (int i = 1; i < num_layers; i++) {
-                        char layer_str[32];
-                        snprintf(layer_str, sizeof(layer_str), "→%zu", layer_sizes[i]);
-                        strcat(architecture, layer_str);
-                    }
-                    
-                    char dataset_info[128];
-                    // Utiliser le nom du dataset depuis la configuration ou un nom générique
-                    const char *dataset_display_name = "Dataset";
-                    if (strlen(dataset_config.dataset_name) > 0) {
-                        dataset_display_name = dataset_config.dataset_name;
-                    }
-                    snprintf(dataset_info, sizeof(dataset_info), "%s (%zu échantillons)", dataset_display_name, dataset->num_samples);
-                    
-                    // Class weights adaptatifs selon la méthode neuroplast (OPTIMISÉ POUR >95%)
-                    float class_weights[2] = {1.0f, 1.0f}; // Équilibré par défaut
-                    if (strcmp(neuroplast_methods[m], "adaptive") == 0) {
-                        class_weights[0] = 0.85f; class_weights[1] = 1.15f; // 0.8/1.2 → 0.85/1.15
-                    } else if (strcmp(neuroplast_methods[m], "bayesian") == 0) {
-                        class_weights[0] = 0.95f; class_weights[1] = 1.05f; // 0.9/1.1 → 0.95/1.05
-                    } else if (strcmp(neuroplast_methods[m], "swarm") == 0) {
-                        class_weights[0] = 1.05f; class_weights[1] = 0.95f; // 1.1/0.9 → 1.05/0.95
-                    } else if (strcmp(neuroplast_methods[m], "advanced") == 0) {
-                        class_weights[0] = 0.9f; class_weights[1] = 1.1f;   // Nouveau
-                    } else if (strcmp(neuroplast_methods[m], "progressive") == 0) {
-                        class_weights[0] = 1.02f; class_weights[1] = 0.98f; // Nouveau
-                    } else if (strcmp(neuroplast_methods[m], "propagation") == 0) {
-                        class_weights[0] = 0.98f; class_weights[1] = 1.02f; // Nouveau
-                    }
-                    
-                    progress_display_network_info(architecture, dataset_info, lr, class_weights);
-                    
-                    AllMetrics trial_best_metrics = {0};  // Meilleures métriques pour cet essai
-                    int trial_convergence = 0;
-                    int convergence_epoch = -1;  // Époque de convergence pour cet essai
-                    float current_loss = 1.0f;
-                    
-                    // 🔧 CORRECTION MAJEURE: Variables pour early stopping (DÉPLACÉES HORS DE LA BOUCLE)
-                    float best_f1_score = 0.0f;
-                    int patience_counter = 0;
-                    
-                    // Réinitialiser la barre des époques pour cet essai
-                    progress_global_update(epochs_bar, 0, 0.0f, 0.0f, 0.0f);
-                    
-                    // Entraînement avec affichage des métriques toutes les 5 époques
-                    for (int epoch = 0; epoch < max_epochs; epoch++) {
-                        current_loss = 0.0f;
-                        int should_stop_early = 0;
-                        
-                        // Entraînement sur tout le dataset d'entraînement (MULTI-PASS POUR OPTIMISATION)
-                        for (int pass = 0; pass < 2; pass++) { // 2 passages par époque pour meilleur apprentissage
-                            for (size_t i = 0; i < train_set->num_samples; i++) {
-                                // ENTRAÎNEMENT POUR TOUTES LES MÉTHODES NEUROPLAST
-                                network_forward_simple(network, train_set->inputs[i]);
-                                network_backward_simple(network, train_set->inputs[i], train_set->outputs[i], lr);
-                                
-                                // 🔧 CORRECTION: Revenir au calcul MSE qui fonctionnait (seulement au premier passage)
-                                if (pass == 0) {
-                                    float *output = network_output_simple(network);
-                                    if (output) {
-                                        float error = output[0] - train_set->outputs[i][0];
-                                        current_loss += error * error;
-                                    }
-                                }
-                            }
-                        }
-                        
-                        // Normaliser le loss par le nombre d'échantillons
-                        current_loss = current_loss / train_set->num_samples;
-                        
-                        // Calcul des métriques toutes les 5 époques OU si early stopping activé
-                        if (epoch % 5 == 0 || epoch == max_epochs - 1 || dataset_config.early_stopping) {
-                            AllMetrics test_metrics = compute_all_metrics(network, test_set, &dataset_config);
-                            
-                            // Mettre à jour les meilleures métriques pour cet essai
-                            if (test_metrics.f1_score > trial_best_metrics.f1_score) {
-                                trial_best_metrics = test_metrics;
-                            }
-                            
-                            // 🔧 EARLY STOPPING SIMPLIFIÉ (comme dans la version qui fonctionnait)
-                            if (dataset_config.early_stopping && epoch > 10) { // Attendre au moins 10 époques
-                                if (test_metrics.f1_score > best_f1_score + 0.01f) { // Amélioration significative
-                                    best_f1_score = test_metrics.f1_score;
-                                    patience_counter = 0;
-                                } else {
-                                    patience_counter++;
-                                    if (patience_counter >= dataset_config.patience && best_f1_score > 0.1f) {
-                                        should_stop_early = 1;
-                                        printf("🛑 Early stopping à l'époque %d (patience: %d, meilleur F1: %.3f)\n", 
-                                               epoch, dataset_config.patience, best_f1_score);
-                                    }
-                                }
-                            }
-                            
-                            if (test_metrics.f1_score >= 0.90f && !trial_convergence) { // Convergence à 90% F1
-                                trial_convergence = 1;
-                                convergence_epoch = epoch;
-                            }
-                            
-                            // AFFICHAGE ORGANISÉ DES INFORMATIONS D'ÉPOQUE
-                            if (epoch % 5 == 0 || epoch == max_epochs - 1) {
-                                progress_display_epoch_info(epoch, max_epochs, current_loss, 
-                                                           test_metrics.accuracy, test_metrics.precision,
-                                                           test_metrics.recall, test_metrics.f1_score);
-                            }
-                            
-                            // Mettre à jour la barre des époques avec métriques toutes les 5 époques
-                            progress_global_update(epochs_bar, epoch + 1, current_loss, test_metrics.f1_score, lr);
-                        }
-                        
-                        // Early stopping pour éviter l'overfitting (simplifié)
-                        if (should_stop_early || (trial_convergence && epoch > max_epochs / 3)) {
-                            if (should_stop_early) {
-                                print_info_safe("🛑 Arrêt précoce par early stopping");
-                            } else {
-                                print_info_safe("✅ Convergence précoce détectée");
-                            }
-                            break;
-                        }
-                    }
-                    
-                    // 🎯 ÉVALUER ET SAUVEGARDER LE MODÈLE AVEC NOTRE SYSTÈME INTÉGRÉ
-                    // Calculer les métriques finales pour la sauvegarde
-                    AllMetrics final_metrics = compute_all_metrics(network, test_set, &dataset_config);
-                    AllMetrics train_metrics = compute_all_metrics(network, train_set, &dataset_config);
-                    
-                    // Créer le nom du modèle
-                    char model_name[128];
-                    snprintf(model_name, sizeof(model_name), "%s+%s+%s", 
-                            neuroplast_methods[m], optimizers[o], activations[a]);
-                    
-                    // Ajouter ce modèle aux candidats pour le top 10
-                    int save_result = add_candidate_model(
-                        model_name,
-                        optimizers[o],
-                        neuroplast_methods[m], 
-                        activations[a],
-                        train_metrics.accuracy,
-                        current_loss,
-                        final_metrics.accuracy,
-                        1.0f - final_metrics.f1_score, // Approximation de la validation loss
-                        final_metrics.f1_score,
-                        lr,
-                        combination_count * 1000 + trial
-                    );
-                    
-                    if (save_result == 1) {
-                        char save_info[256];
-                        snprintf(save_info, sizeof(save_info), 
-                                "🏆 Modèle %s ajouté au TOP 10! F1=%.1f%% Acc=%.1f%%", 
-                                model_name, 
-                                final_metrics.f1_score * 100, 
-                                final_metrics.accuracy * 100);
-                        print_info_safe(save_info);
-                    }
-                    
-                    // Ajouter les métriques de cet essai aux totaux
-                    total_metrics.accuracy += trial_best_metrics.accuracy;
-                    total_metrics.precision += trial_best_metrics.precision;
-                    total_metrics.recall += trial_best_metrics.recall;
-                    total_metrics.f1_score += trial_best_metrics.f1_score;
-                    total_metrics.auc_roc += trial_best_metrics.auc_roc;
-                    
-                    // Mettre à jour les meilleures métriques globales si nécessaire
-                    if (trial_best_metrics.accuracy > best_metrics.accuracy) best_metrics.accuracy = trial_best_metrics.accuracy;
-                    if (trial_best_metrics.precision > best_metrics.precision) best_metrics.precision = trial_best_metrics.precision;
-                    if (trial_best_metrics.recall > best_metrics.recall) best_metrics.recall = trial_best_metrics.recall;
-                    if (trial_best_metrics.f1_score > best_metrics.f1_score) best_metrics.f1_score = trial_best_metrics.f1_score;
-                    if (trial_best_metrics.auc_roc > best_metrics.auc_roc) best_metrics.auc_roc = trial_best_metrics.auc_roc;
-                    
-                    if (trial_convergence) convergence_count++;
-                    
-                    // AFFICHAGE ORGANISÉ DU RÉSUMÉ D'ESSAI
-                    progress_display_trial_summary(trial, trials, trial_best_metrics.accuracy, 
-                                                  trial_best_metrics.f1_score, convergence_epoch);
-                    
-                    // Mettre à jour la barre des essais
-                    float trial_loss = (trial_best_metrics.f1_score > 0) ? (1.0f - trial_best_metrics.f1_score) : current_loss;
-                    progress_global_update(trials_bar, trial + 1, trial_loss, trial_best_metrics.f1_score, lr);
-                    
-                    network_free_simple(network);
-                }
-                
-                // Stocker le résultat de cette combinaison avec toutes les métriques
-                strcpy(results[result_count].method, neuroplast_methods[m]);
-                strcpy(results[result_count].optimizer, optimizers[o]);
-                strcpy(results[result_count].activation, activations[a]);
-                snprintf(results[result_count].full_name, sizeof(results[result_count].full_name),
-                        "%s+%s+%s", neuroplast_methods[m], optimizers[o], activations[a]);
-                
-                // Calculer les moyennes pour chaque métrique
-                results[result_count].avg_accuracy = total_metrics.accuracy / trials;
-                results[result_count].avg_precision = total_metrics.precision / trials;
-                results[result_count].avg_recall = total_metrics.recall / trials;
-                results[result_count].avg_f1_score = total_metrics.f1_score / trials;
-                results[result_count].avg_auc_roc = total_metrics.auc_roc / trials;
-                
-                // Sauvegarder les meilleures métriques
-                results[result_count].best_accuracy = best_metrics.accuracy;
-                results[result_count].best_precision = best_metrics.precision;
-                results[result_count].best_recall = best_metrics.recall;
-                results[result_count].best_f1_score = best_metrics.f1_score;
-                results[result_count].best_auc_roc = best_metrics.auc_roc;
-                results[result_count].convergence_count = convergence_count;
-                results[result_count].total_trials = trials;
-                results[result_count].convergence_rate = (float)convergence_count / trials;
-                
-                // AFFICHAGE ORGANISÉ DU RÉSUMÉ DE COMBINAISON
-                progress_display_combination_summary(results[result_count].avg_f1_score, 
-                                                   results[result_count].best_f1_score,
-                                                   convergence_count, trials);
-                
-                result_count++;
-                
-                // Mettre à jour la barre de progression générale
-                float avg_loss = (results[result_count-1].avg_f1_score > 0) ? (1.0f - results[result_count-1].avg_f1_score) : 1.0f;
-                float current_accuracy = results[result_count-1].avg_f1_score;
-                progress_global_update(general_bar, combination_count, avg_loss, current_accuracy, 0.001f);
-                
-                // Préparer l'affichage pour la prochaine combinaison
-                progress_prepare_next_combination();
+    // TOUTES LES COMBINAISONS x TOUS LES ESSAIS ; en recherche par paliers, seules
+    // les meilleures combinaisons de chaque palier passent au budget suivant
+    int rung_epochs[HYPERBAND_MAX_RUNGS], rung_sizes[HYPERBAND_MAX_RUNGS];
+    int num_rungs = sweep_plan_rungs(search, max_epochs, total_combinations, rung_epochs, rung_sizes);
+    for (int c = 0; c < total_combinations; c++) active[c] = c;
+    sweep.num_rungs = num_rungs;
+    
+    SweepTiming timing;
+    memset(&timing, 0, sizeof(timing));
+    long trials_run = 0, trials_fixed = 0;
+    for (int rung = 0; rung < num_rungs; rung++) {
+        sweep.rung = rung;
+        sweep.max_epochs = rung_epochs[rung];
+        sweep.num_active = rung_sizes[rung];
+        
+        if (num_rungs > 1) {
+            printf("\n✂️ Palier %d/%d : %d combinaisons x %d essais, %d époques max\n",
+                   rung + 1, num_rungs, sweep.num_active,
+                   sequential ? SEQUENTIAL_MIN_TRIALS : trials, sweep.max_epochs);
+        }
+        int places = rung + 1 < num_rungs ? rung_sizes[rung + 1] : SEQUENTIAL_TOP_K;
+        sweep_run_rung(&sweep, jobs, &timing, places);
+        for (int i = 0; i < sweep.num_active; i++) {
+            trials_run += trials_done[active[i]];
+            trials_fixed += SWEEP_TRIALS_PER_COMBINATION;
+        }
+        if (rung + 1 < num_rungs) sweep_promote(&sweep, active, rung_sizes[rung + 1]);
+    }
+    sweep.max_epochs = max_epochs;
+    if (sweep.trials_deduplicated > 0) {
+        printf("\n🧬 %d essai(s) d'entraînement identique à un autre (même empreinte) : exécutés une fois,\n"
+               "   résultat reporté sur chaque combinaison concernée\n", sweep.trials_deduplicated);
+    }
+    int unhealthy = 0;
+    for (int h = HEALTH_OK + 1; h < HEALTH_STATUS_COUNT; h++) unhealthy += sweep.health_counts[h];
+    if (unhealthy > 0 || sweep.health_restarts > 0) {
+        printf("\n🩺 Surveillance de santé : %d essai(s) abandonné(s), %d redémarrage(s), %ld époques évitées\n",
+               unhealthy, sweep.health_restarts, sweep.health_epochs_saved);
+        for (int h = HEALTH_OK + 1; h < HEALTH_STATUS_COUNT; h++) {
+            if (sweep.health_counts[h] > 0) {
+                printf("   %-14s : %d\n", health_status_name((HealthStatus)h), sweep.health_counts[h]);
+            }
+        }
+    }
+    if (journal_open) {
+        if (sweep.trials_resumed > 0) {
+            printf("\n🔁 %d essai(s) repris du journal %s\n", sweep.trials_resumed, journal_path);
+        }
+        sweep_journal_close(&journal);
+        sweep.journal = NULL;
+    }
+    
+    if (jobs > 1) {
+        const SweepScheduleStats *schedule = &timing.total;
+        printf("\n⏱️ Ordonnancement : %d threads, durée %.1fs, occupation %.0f%%, %zu vol(s)\n",
+               schedule->jobs, schedule->makespan_seconds,
+               schedule->makespan_seconds > 0 ? 100.0 * schedule->busy_seconds / (schedule->makespan_seconds * schedule->jobs) : 0.0,
+               schedule->steals);
+        // Durées mesurées par architecture face au coût estimé
+        for (int v = 0; v < 6; v++) {
+            int count = timing.arch_trials[v];
+            double seconds = timing.arch_seconds[v], flops = timing.arch_flops[v];
+            if (count > 0) {
+                printf("   Architecture %d : %3d essais, %.2fs/essai, %.1f GFLOP estimés/essai (%.2f GFLOP/s)\n",
+                       v, count, seconds / count, flops / count * 1e-9,
+                       seconds > 0 ? flops / seconds * 1e-9 : 0.0);
             }
         }
     }
+    free(active);
+    free(run_tasks);
+    free(next_alias);
+    pthread_mutex_destroy(&sweep.lock);
+    free(outcomes);
+    free(trials_done);
+    free(trials_planned);
+    int result_count = total_combinations;
     
     // ANALYSE DES RÉSULTATS EXHAUSTIFS (même logique que test_all())
     printf("\n🔸 ANALYSE DES RÉSULTATS EXHAUSTIFS (DATASET RÉEL)\n");
@@ -1612,7 +2515,7 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     // Trier par score moyen (bubble sort)
     for (int i = 0; i < result_count - 1; i++) {
         for (int j = 0; j < result_count - i - 1; j++) {
-            if (results[j].avg_f1_score < results[j + 1].avg_f1_score) {
+            if (combination_ranks_before(&results[j + 1], &results[j])) {
                 CombinationResult temp = results[j];
                 results[j] = results[j + 1];
                 results[j + 1] = temp;
@@ -1623,12 +2526,12 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     // TOP 10 des meilleures combinaisons
     printf("🥇 TOP 10 DES MEILLEURES COMBINAISONS (TOUTES MÉTRIQUES) :\n");
     printf("═══════════════════════════════════════════════════════════════════════════════════════════════════════════\n");
-    printf("Rang | Combinaison                          | Accuracy | Precision | Recall | F1-Score | AUC-ROC | Conv %%\n");
-    printf("-----|--------------------------------------|----------|-----------|--------|----------|---------|-------\n");
+    printf("Rang | Combinaison                          | Accuracy | Precision | Recall | F1-Score | AUC-ROC | Conv %% | Essais | IC95 F1\n");
+    printf("-----|--------------------------------------|----------|-----------|--------|----------|---------|--------|--------|--------\n");
     
     int top_display = (result_count < 10) ? result_count : 10;
     for (int i = 0; i < top_display; i++) {
-        printf("%4d | %-36s | %7.1f%% | %8.1f%% | %5.1f%% | %7.1f%% | %6.1f%% | %5.0f%%\n", 
+        printf("%4d | %-36s | %7.1f%% | %8.1f%% | %5.1f%% | %7.1f%% | %6.1f%% | %5.0f%% | %6d | ±%5.1f\n", 
                i + 1, 
                results[i].full_name,
                results[i].avg_accuracy * 100,
@@ -1636,7 +2539,44 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
                results[i].avg_recall * 100,
                results[i].avg_f1_score * 100,
                results[i].avg_auc_roc * 100,
-               results[i].convergence_rate * 100);
+               results[i].convergence_rate * 100,
+               results[i].total_trials,
+               results[i].f1_ci95 * 100);
+    }
+    
+    // Essais séquentiels : où le calcul est allé
+    if (sequential) {
+        int stops[TRIALS_CAPPED + 1] = {0};
+        for (int i = 0; i < result_count; i++) stops[results[i].trials_stop]++;
+        printf("\n📐 ESSAIS SÉQUENTIELS (IC 95%% du F1 moyen) :\n");
+        printf("   %ld essais contre %ld à %d essais fixes (%.0f%%)\n", trials_run, trials_fixed,
+               SWEEP_TRIALS_PER_COMBINATION, trials_fixed > 0 ? 100.0 * trials_run / trials_fixed : 0.0);
+        printf("   Arrêts (dernier palier de chaque combinaison) : %d précises (IC ≤ ±%.0f point), "
+               "%d hors TOP, %d au plafond de %d essais\n",
+               stops[TRIALS_PRECISE], SEQUENTIAL_CI_HALF_WIDTH * 100, stops[TRIALS_OUT_OF_TOP],
+               stops[TRIALS_CAPPED], SEQUENTIAL_MAX_TRIALS);
+    }
+    
+    // Élagage : combinaisons arrêtées à chaque palier (classement trié par palier atteint)
+    if (num_rungs > 1) {
+        printf("\n✂️ RECHERCHE PAR PALIERS (successive halving, η=%d) :\n", HYPERBAND_ETA);
+        double epochs_spent = 0.0;
+        int first = 0;
+        for (int rung = num_rungs - 1; rung >= 0; rung--) {
+            int count = 0;
+            while (first + count < result_count && results[first + count].rung == rung) count++;
+            epochs_spent += (double)rung_sizes[rung] * rung_epochs[rung];
+            if (rung == num_rungs - 1) {
+                printf("   Palier %d (%3d époques) : %3d finalistes\n", rung + 1, rung_epochs[rung], count);
+            } else if (count > 0) {
+                printf("   Palier %d (%3d époques) : %3d élaguées sur %3d | meilleure élaguée : %s (F1 %.1f%%)\n",
+                       rung + 1, rung_epochs[rung], count, rung_sizes[rung],
+                       results[first].full_name, results[first].avg_f1_score * 100);
+            }
+            first += count;
+        }
+        printf("   Budget d'époques : %.0f%% du balayage exhaustif\n",
+               100.0 * epochs_spent / ((double)total_combinations * max_epochs));
     }
     
     // Statistiques par méthode neuroplast
@@ -1735,9 +2675,11 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     }
     
     // Finaliser les barres de progression
-    progress_global_finish(general_bar);
-    progress_global_finish(trials_bar);
-    progress_global_finish(epochs_bar);
+    if (!sweep.compact) {
+        progress_global_finish(sweep.general_bar);
+        progress_global_finish(sweep.trials_bar);
+        progress_global_finish(sweep.epochs_bar);
+    }
     
     // Désactiver le mode progression sécurisé pour les messages finaux
     colored_output_set_progress_mode(0);
@@ -1753,7 +2695,7 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     // Tri des résultats par F1-Score moyen (meilleur en premier)
     for (int i = 0; i < result_count - 1; i++) {
         for (int j = 0; j < result_count - i - 1; j++) {
-            if (results[j].avg_f1_score < results[j + 1].avg_f1_score) {
+            if (combination_ranks_before(&results[j + 1], &results[j])) {
                 CombinationResult temp = results[j];
                 results[j] = results[j + 1];
                 results[j + 1] = temp;
@@ -1773,8 +2715,14 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
         fprintf(csv_file, "# Dataset: Médical simulé (%zu échantillons, %zu features)\n", dataset_num_samples, dataset_input_cols);
         fprintf(csv_file, "# Architecture: Input(%zu)→256→128→Output(%zu)\n", dataset_input_cols, dataset_output_cols);
         fprintf(csv_file, "# Total combinaisons: %d\n", total_combinations);
-        fprintf(csv_file, "# Essais par combinaison: 5\n");
-        fprintf(csv_file, "# Époques max: 50\n");
+        if (sequential) {
+            fprintf(csv_file, "# Essais par combinaison: %d à %d (--sequential, arrêt dès que l'IC 95%% du F1 moyen "
+                    "fait moins de ±%.0f point ou exclut le TOP %d)\n", SEQUENTIAL_MIN_TRIALS, SEQUENTIAL_MAX_TRIALS,
+                    SEQUENTIAL_CI_HALF_WIDTH * 100, SEQUENTIAL_TOP_K);
+        } else {
+            fprintf(csv_file, "# Essais par combinaison: %d\n", trials);
+        }
+        fprintf(csv_file, "# Époques max: %d\n", max_epochs);
         fprintf(csv_file, "# Features médicales: Age, Cholestérol, Tension, BMI, Exercice, Tabac, Antécédents, Stress\n");
         fprintf(csv_file, "# Modèle de risque: Interactions complexes + bruit réaliste\n");
         fprintf(csv_file, "# Toutes les métriques: Accuracy, Precision, Recall, F1-Score, AUC-ROC\n");
@@ -1784,7 +2732,8 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
         fprintf(csv_file, "Rang,Methode,Optimiseur,Activation,Combinaison_Complete,");
         fprintf(csv_file, "Avg_Accuracy_Pct,Avg_Precision_Pct,Avg_Recall_Pct,Avg_F1_Score_Pct,Avg_AUC_ROC_Pct,");
         fprintf(csv_file, "Best_Accuracy_Pct,Best_Precision_Pct,Best_Recall_Pct,Best_F1_Score_Pct,Best_AUC_ROC_Pct,");
-        fprintf(csv_file, "Convergence_Count,Total_Trials,Taux_Convergence_Pct\n");
+        fprintf(csv_file, "Convergence_Count,Total_Trials,Taux_Convergence_Pct,");
+        fprintf(csv_file, "Palier,Epoques_Palier,Statut,IC95_F1_Pct,Arret_Essais,Essais_Interrompus\n");
         
         // Données triées avec toutes les métriques
         for (int i = 0; i < result_count; i++) {
@@ -1812,10 +2761,22 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
                    results[i].best_auc_roc * 100);
             
             // Informations de convergence
-            fprintf(csv_file, "%d,%d,%.2f\n",
+            fprintf(csv_file, "%d,%d,%.2f,",
                    results[i].convergence_count,
                    results[i].total_trials,
                    results[i].convergence_rate);
+            
+            // Palier atteint (recherche par paliers)
+            fprintf(csv_file, "%d,%d,%s,",
+                   results[i].rung + 1,
+                   results[i].rung_epochs,
+                   num_rungs == 1 ? "complet" : (results[i].rung == num_rungs - 1 ? "finaliste" : "elague"));
+            
+            // Intervalle de confiance et arrêt des essais (--sequential)
+            fprintf(csv_file, "%.2f,%s,%d\n",
+                   results[i].f1_ci95 * 100,
+                   trials_stop_name(results[i].trials_stop),
+                   results[i].unhealthy_trials);
         }
         
         fclose(csv_file);
@@ -1877,6 +2838,142 @@ int test_all_with_real_dataset(const char **neuroplast_methods, int num_methods,
     return 0;
 }
 
+// Valeur de l'option name (--option valeur), ou NULL
+static const char *argument_value(const char *name) {
+    for (int i = 1; i < argc_global - 1; i++) {
+        if (strcmp(argv_global[i], name) == 0) return argv_global[i + 1];
+    }
+    return NULL;
+}
+
+static int argument_present(const char *name) {
+    for (int i = 1; i < argc_global; i++) {
+        if (strcmp(argv_global[i], name) == 0) return 1;
+    }
+    return 0;
+}
+
+// --jobs N : nombre d'essais exécutés en parallèle (0 ou "auto" = nombre de cœurs)
+static int parse_jobs_argument(void) {
+    for (int i = 1; i < argc_global - 1; i++) {
+        if (strcmp(argv_global[i], "--jobs") == 0) {
+            int jobs = atoi(argv_global[i + 1]);
+            return (jobs > 0) ? jobs : sweep_default_jobs();
+        }
+    }
+    return 1;
+}
+
+// --search exhaustive|hyperband : stratégie du test exhaustif (défaut : exhaustive)
+static SweepSearchMode parse_search_argument(void) {
+    for (int i = 1; i < argc_global - 1; i++) {
+        if (strcmp(argv_global[i], "--search") == 0) {
+            if (strcmp(argv_global[i + 1], "hyperband") == 0) return SWEEP_SEARCH_HYPERBAND;
+            if (strcmp(argv_global[i + 1], "exhaustive") != 0) {
+                printf("⚠️ Stratégie de recherche inconnue '%s', balayage exhaustif\n", argv_global[i + 1]);
+            }
+        }
+    }
+    return SWEEP_SEARCH_EXHAUSTIVE;
+}
+
+// --export-journal PATH : CSV des combinaisons du dernier balayage d'un journal,
+// même interrompu. Chaque combinaison est agrégée sur les essais de son plus
+// grand budget d'époques (palier le plus haut en recherche par paliers).
+static int export_sweep_journal(const char *path, const RichConfig *cfg, const char *config_path) {
+    SweepJournal journal;
+    if (!sweep_journal_load(&journal, path)) return EXIT_FAILURE;
+    
+    CombinationResultComplete *results = calloc(journal.count ? journal.count : 1, sizeof(CombinationResultComplete));
+    int *epochs = calloc(journal.count ? journal.count : 1, sizeof(int));
+    if (!results || !epochs) {
+        printf("❌ Erreur allocation mémoire pour l'export du journal\n");
+        free(results);
+        free(epochs);
+        sweep_journal_close(&journal);
+        return EXIT_FAILURE;
+    }
+    
+    int result_count = 0, max_epochs = 0;
+    size_t trials_used = 0;
+    for (size_t i = 0; i < journal.count; i++) {
+        const JournalTrial *t = &journal.entries[i];
+        if (t->config_hash != journal.config_hash || t->base_seed != journal.base_seed) continue;
+        
+        char full_name[128];
+        snprintf(full_name, sizeof(full_name), "%s+%s+%s", t->method, t->optimizer, t->activation);
+        int r = 0;
+        while (r < result_count && strcmp(results[r].full_name, full_name) != 0) r++;
+        if (r == result_count) result_count++;
+        CombinationResultComplete *c = &results[r];
+        if (t->epochs < epochs[r]) continue;
+        if (t->epochs > epochs[r]) {
+            memset(c, 0, sizeof(*c));
+            epochs[r] = t->epochs;
+            snprintf(c->method, sizeof(c->method), "%s", t->method);
+            snprintf(c->optimizer, sizeof(c->optimizer), "%s", t->optimizer);
+            snprintf(c->activation, sizeof(c->activation), "%s", t->activation);
+            snprintf(c->full_name, sizeof(c->full_name), "%s", full_name);
+        }
+        if (t->epochs > max_epochs) max_epochs = t->epochs;
+        
+        // Sommes et maxima, moyennés plus bas (comme sweep_aggregate_combination)
+        c->avg_accuracy += t->accuracy;
+        c->avg_precision += t->precision;
+        c->avg_recall += t->recall;
+        c->avg_f1_score += t->f1_score;
+        c->avg_auc_roc += t->auc_roc;
+        if (t->accuracy > c->best_accuracy) c->best_accuracy = t->accuracy;
+        if (t->precision > c->best_precision) c->best_precision = t->precision;
+        if (t->recall > c->best_recall) c->best_recall = t->recall;
+        if (t->f1_score > c->best_f1_score) c->best_f1_score = t->f1_score;
+        if (t->auc_roc > c->best_auc_roc) c->best_auc_roc = t->auc_roc;
+        if (t->converged) c->convergence_count++;
+        c->total_trials++;
+    }
+    
+    for (int r = 0; r < result_count; r++) {
+        CombinationResultComplete *c = &results[r];
+        trials_used += c->total_trials;
+        c->avg_accuracy /= c->total_trials;
+        c->avg_precision /= c->total_trials;
+        c->avg_recall /= c->total_trials;
+        c->avg_f1_score /= c->total_trials;
+        c->avg_auc_roc /= c->total_trials;
+        c->convergence_rate = (float)c->convergence_count / c->total_trials;
+    }
+    
+    // Classement : budget d'époques le plus haut d'abord, puis F1 moyen
+    for (int i = 1; i < result_count; i++) {
+        CombinationResultComplete c = results[i];
+        int e = epochs[i], j = i;
+        while (j > 0 && (e > epochs[j - 1] || (e == epochs[j - 1] && c.avg_f1_score > results[j - 1].avg_f1_score))) {
+            results[j] = results[j - 1];
+            epochs[j] = epochs[j - 1];
+            j--;
+        }
+        results[j] = c;
+        epochs[j] = e;
+    }
+    
+    printf("📓 Journal %s : %zu essais du dernier balayage (configuration %016llx), %d combinaisons\n",
+           path, trials_used, (unsigned long long)journal.config_hash, result_count);
+    int ok = result_count > 0;
+    if (ok) {
+        const char *dataset_name = strlen(cfg->dataset_name) > 0 ? cfg->dataset_name : "journal";
+        ok = export_results_to_csv_complete(results, result_count, config_path ? config_path : path,
+                                            (size_t)cfg->input_cols, (size_t)cfg->output_cols,
+                                            result_count, max_epochs, 0, dataset_name);
+    } else {
+        printf("⚠️ Aucun essai à exporter\n");
+    }
+    
+    free(results);
+    free(epochs);
+    sweep_journal_close(&journal);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 // Test complet de tous les ensembles avec comparaison (dataset réaliste avec toutes les métriques)
 int test_all(const RichConfig *cfg) {
     printf("🚀 TEST EXHAUSTIF DE TOUTES LES COMBINAISONS\n");
@@ -1948,10 +3045,18 @@ int test_all(const RichConfig *cfg) {
         printf("📁 Utilisation de la configuration par défaut: %s\n", config_file);
     }
     
+    SweepOptions options;
+    options.jobs = parse_jobs_argument();
+    options.search = parse_search_argument();
+    options.journal_path = argument_value("--journal");
+    options.resume = argument_present("--resume");
+    options.sequential = argument_present("--sequential");
+    
     return test_all_with_real_dataset(neuroplast_methods, num_methods,
                                      optimizers, num_optimizers,
                                      activations, num_activations,
-                                     config_file, 150); // AUGMENTER LES ÉPOQUES DE 100 À 150
+                                     config_file, 150, // AUGMENTER LES ÉPOQUES DE 100 À 150
+                                     &options);
 }
 
 // Fonction main pour gérer les modes de test
@@ -2002,6 +3107,12 @@ int main(int argc, char *argv[]) {
     print_rich_config(&cfg);
     printf("\n");
     
+    // Export CSV d'un journal de balayage (éventuellement interrompu), sans entraînement
+    const char *journal_to_export = argument_value("--export-journal");
+    if (journal_to_export) {
+        return export_sweep_journal(journal_to_export, &cfg, argument_value("--config"));
+    }
+    
     // Vérifier si c'est un mode de test
     RunMode mode = get_run_mode(argc, argv);
     
@@ -2050,7 +3161,13 @@ int main(int argc, char *argv[]) {
     printf("   --test-all-optimizers\n");
     printf("   --test-neuroplast-methods\n");
     printf("   --test-complete-combinations\n");
-    printf("   --test-benchmark-full\n\n");
+    printf("   --test-benchmark-full\n");
+    printf("   --jobs N (avec --test-all : N essais en parallèle, 0 = tous les cœurs)\n");
+    printf("   --search hyperband (avec --test-all : élagage par paliers des combinaisons faibles)\n");
+    printf("   --resume [--journal PATH] (avec --test-all : reprendre un balayage interrompu)\n");
+    printf("   --sequential (avec --test-all : %d à %d essais par combinaison selon l'IC 95%% du F1)\n",
+           SEQUENTIAL_MIN_TRIALS, SEQUENTIAL_MAX_TRIALS);
+    printf("   --export-journal PATH (CSV des essais terminés d'un journal, même partiel)\n\n");
     
     printf("🔧 Pour utiliser une configuration personnalisée :\n");
     printf("   ./neuroplast-ann --config config/example_early_stopping_enabled.yml --test-all\n");
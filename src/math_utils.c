@@ -1,19 +1,24 @@
 #include "math_utils.h"
 #include <math.h>
 
-// Fonction exponentielle rapide (approximation)
+// Fonction exponentielle rapide (approximation polynomiale, voir math_utils.h)
 float fast_exp(float x) {
-    return expf(x);
+    return approx_exp(x);
 }
 
 // Fonction sigmoid rapide
 float fast_sigmoid(float x) {
-    return 1.0f / (1.0f + fast_exp(-x));
+    return approx_sigmoid(x);
 }
 
 // Fonction tangente hyperbolique rapide
 float fast_tanh(float x) {
-    return tanhf(x);
+    return approx_tanh(x);
+}
+
+// Fonction log(1 + x) rapide
+float fast_log1p(float x) {
+    return approx_log1p(x);
 }
 
 // Fonction ReLU rapide
@@ -43,5 +48,5 @@ float fast_swish(float x) {
 
 // Fonction Mish rapide
 float fast_mish(float x) {
-    return x * fast_tanh(logf(1.0f + fast_exp(x)));
+    return x * fast_tanh(fast_log1p(fast_exp(fminf(x, 20.0f))));
 }
\ No newline at end of file
@@ -1,10 +1,120 @@
 #ifndef MATH_UTILS_H
 #define MATH_UTILS_H
 
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// ============================================================================
+// APPROXIMATIONS POLYNOMIALES SANS BRANCHEMENT
+// ============================================================================
+// Fonctions inline écrites uniquement avec des sélections (?:), des opérations
+// arithmétiques et des manipulations de bits : dans une boucle sur un tableau,
+// GCC les vectorise (-O3 -march=native : AVX-512 / AVX2 / SSE selon le CPU).
+// Bornes d'erreur mesurées par test_activations sur une grille dense, par
+// rapport à la libm en double précision.
+
+// Reconstruire 2^n pour n entier dans [-126, 127] (exposant IEEE-754)
+static inline float approx_pow2i(float n) {
+    int32_t bits = ((int32_t)n + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return scale;
+}
+
+// exp(x) : réduction de Cody-Waite x = n*ln2 + r, |r| <= ln2/2, puis
+// polynôme minimax de degré 7 (coefficients Cephes).
+// Erreur relative < 1e-7 (≈ 1 ulp) sur [-87, 88]. L'argument est borné à
+// [-87, 88] : pas d'infini ni de dénormalisé (exp(-inf) donne ≈ 1.6e-38).
+static inline float approx_exp(float x) {
+    x = x < -87.0f ? -87.0f : x;
+    x = x > 88.0f ? 88.0f : x;
+
+    // n = arrondi(x / ln2) par l'ajout/retrait de 1.5 * 2^23
+    float n = (x * 1.44269504088896341f + 12582912.0f) - 12582912.0f;
+    float r = x - n * 0.693359375f;
+    r = r + n * 2.12194440e-4f;
+
+    float r2 = r * r;
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * r2 + r + 1.0f;
+    return p * approx_pow2i(n);
+}
+
+// sigmoid(x) = 1 / (1 + exp(-x)). Erreur absolue < 1e-7 sur tout R. Erreur
+// relative < 2e-7 seulement pour x >= -88 : en dessous, l'argument de approx_exp
+// est borné à 88 et le résultat reste figé à 1 / (1 + e^88) ≈ 6e-39 alors que la
+// vraie sigmoïde continue de décroître (erreur relative non bornée).
+static inline float approx_sigmoid(float x) {
+    return 1.0f / (1.0f + approx_exp(-x));
+}
+
+// tanh(x) : polynôme impair x + x³ P(x²) pour |x| < 0.625 (Cephes), sinon
+// 1 - 2 / (1 + exp(2|x|)) avec le signe de x. Les deux branches sont calculées
+// puis sélectionnées. Erreur relative < 2e-7, absolue < 1e-7.
+static inline float approx_tanh(float x) {
+    float a = fabsf(x);
+
+    float x2 = x * x;
+    float p = -5.70498872745e-3f;
+    p = p * x2 + 2.06390887954e-2f;
+    p = p * x2 - 5.37397155531e-2f;
+    p = p * x2 + 1.33314422036e-1f;
+    p = p * x2 - 3.33332819422e-1f;
+    float small = x + x * x2 * p;
+
+    float large = 1.0f - 2.0f / (1.0f + approx_exp(2.0f * a));
+    large = copysignf(large, x);
+
+    return a < 0.625f ? small : large;
+}
+
+// log1p(y) pour y > -1 fini : u = 1 + y décomposé en m * 2^k (m dans
+// [sqrt(1/2), sqrt(2))), log(m) par le polynôme de degré 9 de Cephes logf,
+// puis correction de l'arrondi de 1 + y. Erreur relative < 2e-7.
+static inline float approx_log1p(float y) {
+    float u = 1.0f + y;
+    float c = (u - 1.0f) - y;                   // Erreur d'arrondi de u
+
+    int32_t bits;
+    memcpy(&bits, &u, sizeof(bits));
+    int32_t k = ((bits >> 23) & 0xff) - 126;    // u = m * 2^k, m dans [0.5, 1)
+    bits = (bits & 0x007fffff) | 0x3f000000;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+
+    int below = m < 0.70710678f;
+    float e = (float)(below ? k - 1 : k);
+    float f = below ? (m + m) - 1.0f : m - 1.0f;
+
+    float z = f * f;
+    float p = 7.0376836292e-2f;
+    p = p * f - 1.1514610310e-1f;
+    p = p * f + 1.1676998740e-1f;
+    p = p * f - 1.2420140846e-1f;
+    p = p * f + 1.4249322787e-1f;
+    p = p * f - 1.6668057665e-1f;
+    p = p * f + 2.0000714765e-1f;
+    p = p * f - 2.4999993993e-1f;
+    p = p * f + 3.3333331174e-1f;
+    float r = f * z * p;
+    r = r - 2.12194440e-4f * e;
+    r = r - 0.5f * z;
+    r = f + r;
+    r = r + 0.693359375f * e;
+    return r - c / u;
+}
+
 // Fonctions mathématiques optimisées
 float fast_exp(float x);
 float fast_sigmoid(float x);
 float fast_tanh(float x);
+float fast_log1p(float x);
 float fast_relu(float x);
 float fast_leaky_relu(float x, float alpha);
 float fast_gelu(float x);
@@ -12,4 +122,4 @@ float fast_elu(float x, float alpha);
 float fast_swish(float x);
 float fast_mish(float x);
 
-#endif /* MATH_UTILS_H */
\ No newline at end of file
+#endif /* MATH_UTILS_H */
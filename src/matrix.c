@@ -1,45 +1,128 @@
 #include "matrix.h"
 #include "memory.h"
+#include "gemm.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <time.h>
 
-// Créer une matrice vide
+// Arrondir le nombre de colonnes au multiple d'alignement supérieur
+static size_t matrix_padded_stride(size_t cols) {
+    return (cols + MATRIX_ALIGN_FLOATS - 1) / MATRIX_ALIGN_FLOATS * MATRIX_ALIGN_FLOATS;
+}
+
+// Créer une matrice vide (un seul tampon aligné, lignes alignées)
 Matrix *matrix_create(size_t rows, size_t cols) {
     Matrix *mat = mem_alloc(sizeof(Matrix));
     mat->rows = rows;
     mat->cols = cols;
-    mat->data = mem_alloc(rows * sizeof(float *));
-    for (size_t i = 0; i < rows; i++)
-        mat->data[i] = mem_calloc(cols, sizeof(float));
+    mat->row_stride = matrix_padded_stride(cols);
+    mat->col_stride = 1;
+    mat->data = mem_aligned_calloc(MATRIX_ALIGNMENT, rows * mat->row_stride, sizeof(float));
+    mat->owns_data = 1;
     return mat;
 }
 
-// Libérer une matrice
+// Libérer une matrice (le tampon n'est libéré que si la matrice en est propriétaire)
 void matrix_free(Matrix *mat) {
     if (mat) {
-        for (size_t i = 0; i < mat->rows; i++)
-            mem_free(mat->data[i]);
-        mem_free(mat->data);
+        if (mat->owns_data)
+            mem_aligned_free(mat->data);
         mem_free(mat);
     }
 }
 
+// Vue sur un tampon externe en ordre ligne (aucune copie)
+Matrix matrix_view(float *data, size_t rows, size_t cols, size_t row_stride) {
+    Matrix view;
+    view.rows = rows;
+    view.cols = cols;
+    view.row_stride = row_stride;
+    view.col_stride = 1;
+    view.data = data;
+    view.owns_data = 0;
+    return view;
+}
+
+// Vue sur une plage de lignes consécutives
+Matrix matrix_view_rows(const Matrix *mat, size_t first_row, size_t num_rows) {
+    return matrix_view_block(mat, first_row, 0, num_rows, mat->cols);
+}
+
+// Vue sur un sous-bloc rectangulaire
+Matrix matrix_view_block(const Matrix *mat, size_t first_row, size_t first_col,
+                         size_t num_rows, size_t num_cols) {
+    if (first_row + num_rows > mat->rows || first_col + num_cols > mat->cols) {
+        fprintf(stderr, "Erreur : sous-bloc [%zu+%zu, %zu+%zu] hors de la matrice %zux%zu.\n",
+                first_row, num_rows, first_col, num_cols, mat->rows, mat->cols);
+        exit(EXIT_FAILURE);
+    }
+
+    Matrix view = *mat;
+    view.rows = num_rows;
+    view.cols = num_cols;
+    view.data = mat->data + first_row * mat->row_stride + first_col * mat->col_stride;
+    view.owns_data = 0;
+    return view;
+}
+
+// Vue transposée (échange des dimensions et des pas, aucune copie)
+Matrix matrix_view_transpose(const Matrix *mat) {
+    Matrix view = *mat;
+    view.rows = mat->cols;
+    view.cols = mat->rows;
+    view.row_stride = mat->col_stride;
+    view.col_stride = mat->row_stride;
+    view.owns_data = 0;
+    return view;
+}
+
+// Vrai si les lignes sont contiguës en mémoire (col_stride == 1)
+int matrix_is_contiguous(const Matrix *mat) {
+    return mat->col_stride == 1;
+}
+
 // Remplir une matrice avec une valeur spécifique
 void matrix_fill(Matrix *mat, float value) {
     for (size_t i = 0; i < mat->rows; i++)
         for (size_t j = 0; j < mat->cols; j++)
-            mat->data[i][j] = value;
+            MATRIX_AT(mat, i, j) = value;
 }
 
 // Remplir une matrice avec des valeurs aléatoires
 void matrix_randomize(Matrix *mat, float min, float max) {
     for (size_t i = 0; i < mat->rows; i++)
         for (size_t j = 0; j < mat->cols; j++)
-            mat->data[i][j] = min + (max - min) * ((float)rand() / RAND_MAX);
+            MATRIX_AT(mat, i, j) = min + (max - min) * ((float)rand() / RAND_MAX);
+}
+
+// Produit matriciel général : out = alpha * a * b + beta * out
+void matrix_gemm(float alpha, const Matrix *a, const Matrix *b, float beta, Matrix *out) {
+    if (a->cols != b->rows || out->rows != a->rows || out->cols != b->cols) {
+        fprintf(stderr, "Erreur : dimensions incompatibles pour le produit matriciel "
+                "(%zux%zu * %zux%zu -> %zux%zu).\n",
+                a->rows, a->cols, b->rows, b->cols, out->rows, out->cols);
+        exit(EXIT_FAILURE);
+    }
+
+    gemm(a->rows, b->cols, a->cols,
+         alpha,
+         a->data, (ptrdiff_t)a->row_stride, (ptrdiff_t)a->col_stride,
+         b->data, (ptrdiff_t)b->row_stride, (ptrdiff_t)b->col_stride,
+         beta,
+         out->data, (ptrdiff_t)out->row_stride, (ptrdiff_t)out->col_stride);
 }
 
-// Produit matriciel
+// Produit matriciel dans une matrice préallouée
+void matrix_dot_into(const Matrix *a, const Matrix *b, Matrix *out) {
+    matrix_gemm(1.0f, a, b, 0.0f, out);
+}
+
+// Produit matriciel accumulé dans une matrice préallouée
+void matrix_dot_add_into(const Matrix *a, const Matrix *b, Matrix *out) {
+    matrix_gemm(1.0f, a, b, 1.0f, out);
+}
+
+// Produit matriciel (alloue le résultat)
 Matrix *matrix_dot(Matrix *a, Matrix *b) {
     if (a->cols != b->rows) {
         fprintf(stderr, "Erreur : dimensions incompatibles pour le produit matriciel.\n");
@@ -47,14 +130,7 @@ Matrix *matrix_dot(Matrix *a, Matrix *b) {
     }
 
     Matrix *result = matrix_create(a->rows, b->cols);
-    for (size_t i = 0; i < a->rows; i++) {
-        for (size_t j = 0; j < b->cols; j++) {
-            float sum = 0.0f;
-            for (size_t k = 0; k < a->cols; k++)
-                sum += a->data[i][k] * b->data[k][j];
-            result->data[i][j] = sum;
-        }
-    }
+    matrix_dot_into(a, b, result);
     return result;
 }
 
@@ -67,12 +143,12 @@ void matrix_add(Matrix *dest, Matrix *src) {
 
     for (size_t i = 0; i < dest->rows; i++)
         for (size_t j = 0; j < dest->cols; j++)
-            dest->data[i][j] += src->data[i][j];
+            MATRIX_AT(dest, i, j) += MATRIX_AT(src, i, j);
 }
 
 // Appliquer une fonction à chaque élément de la matrice
 void matrix_apply_function(Matrix *mat, float (*func)(float)) {
     for (size_t i = 0; i < mat->rows; i++)
         for (size_t j = 0; j < mat->cols; j++)
-            mat->data[i][j] = func(mat->data[i][j]);
-}
\ No newline at end of file
+            MATRIX_AT(mat, i, j) = func(MATRIX_AT(mat, i, j));
+}
@@ -3,16 +3,43 @@
 
 #include <stddef.h>
 
+// Alignement du tampon et des lignes (64 octets = une ligne de cache / un registre AVX-512)
+#define MATRIX_ALIGNMENT 64
+#define MATRIX_ALIGN_FLOATS (MATRIX_ALIGNMENT / sizeof(float))
+
+// Matrice stockée dans un seul tampon contigu et aligné.
+// L'élément (i, j) se trouve à data[i * row_stride + j * col_stride].
+// Une matrice propriétaire a col_stride == 1 et row_stride >= cols (lignes alignées) ;
+// une vue (sous-bloc, plage de lignes, transposée) partage le tampon de sa source.
 typedef struct {
     size_t rows;
     size_t cols;
-    float **data;
+    size_t row_stride;   // Distance (en floats) entre deux lignes consécutives
+    size_t col_stride;   // Distance (en floats) entre deux colonnes consécutives
+    float *data;         // Premier élément de la matrice
+    int owns_data;       // 1 = tampon alloué par matrix_create, 0 = vue non propriétaire
 } Matrix;
 
+// Accès élémentaire (valable pour les matrices propriétaires et les vues)
+#define MATRIX_AT(mat, i, j) ((mat)->data[(i) * (mat)->row_stride + (j) * (mat)->col_stride])
+
+// Pointeur sur le début de la ligne i (contigu seulement si col_stride == 1)
+static inline float *matrix_row(const Matrix *mat, size_t i) {
+    return mat->data + i * mat->row_stride;
+}
+
 // Création et suppression
 Matrix *matrix_create(size_t rows, size_t cols);
 void matrix_free(Matrix *mat);
 
+// Vues non propriétaires (aucune copie, retournées par valeur, ne pas libérer)
+Matrix matrix_view(float *data, size_t rows, size_t cols, size_t row_stride);
+Matrix matrix_view_rows(const Matrix *mat, size_t first_row, size_t num_rows);
+Matrix matrix_view_block(const Matrix *mat, size_t first_row, size_t first_col,
+                         size_t num_rows, size_t num_cols);
+Matrix matrix_view_transpose(const Matrix *mat);
+int matrix_is_contiguous(const Matrix *mat);
+
 // Opérations matricielles essentielles
 void matrix_fill(Matrix *mat, float value);
 void matrix_randomize(Matrix *mat, float min, float max);
@@ -20,4 +47,10 @@ Matrix *matrix_dot(Matrix *a, Matrix *b);
 void matrix_add(Matrix *dest, Matrix *src);
 void matrix_apply_function(Matrix *mat, float (*func)(float));
 
-#endif /* MATRIX_H */
\ No newline at end of file
+// Produits écrivant dans une matrice préallouée (aucune allocation).
+// Les opérandes peuvent être des vues (transposées, sous-blocs) ; out ne doit pas
+// chevaucher a ou b.
+void matrix_dot_into(const Matrix *a, const Matrix *b, Matrix *out);       // out = a * b
+void matrix_dot_add_into(const Matrix *a, const Matrix *b, Matrix *out);   // out += a * b
+void matrix_gemm(float alpha, const Matrix *a, const Matrix *b, float beta, Matrix *out);
+#endif /* MATRIX_H */
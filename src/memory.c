@@ -1,6 +1,11 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L  // posix_memalign
+#endif
 #include "memory.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
 
 // Allocation mémoire sécurisée
 void *mem_alloc(size_t size) {
@@ -28,4 +33,80 @@ void mem_free(void *ptr) {
         free(ptr);
         ptr = NULL;
     }
-}
\ No newline at end of file
+}
+
+// Allocation mémoire alignée sécurisée
+void *mem_aligned_alloc(size_t alignment, size_t size) {
+    void *ptr = NULL;
+    if (size == 0) size = alignment;
+    if (posix_memalign(&ptr, alignment, size) != 0 || !ptr) {
+        fprintf(stderr, "Erreur d'allocation mémoire alignée (%zu octets, alignement %zu)\n", size, alignment);
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+// Allocation alignée initialisée à zéro
+void *mem_aligned_calloc(size_t alignment, size_t num, size_t size) {
+    if (size != 0 && num > (size_t)-1 / size) {
+        fprintf(stderr, "Erreur d'allocation mémoire alignée : dépassement de taille\n");
+        exit(EXIT_FAILURE);
+    }
+    void *ptr = mem_aligned_alloc(alignment, num * size);
+    memset(ptr, 0, num * size);
+    return ptr;
+}
+
+// Libération d'un bloc obtenu par mem_aligned_alloc
+void mem_aligned_free(void *ptr) {
+    if (ptr) free(ptr);
+}
+
+// ============================================================================
+// LIBÉRATION À LA SORTIE DES THREADS
+// ============================================================================
+
+#define MEM_THREAD_MAX_RELEASES 8
+
+typedef struct {
+    int count;
+    MemThreadRelease release[MEM_THREAD_MAX_RELEASES];
+    void *slot[MEM_THREAD_MAX_RELEASES];
+} MemThreadReleases;
+
+static pthread_key_t thread_releases_key;
+static pthread_once_t thread_releases_once = PTHREAD_ONCE_INIT;
+static int thread_releases_ready = 0;
+
+// Destructeur de la clé : appelé à la sortie du thread, avant libération de son TLS
+static void run_thread_releases(void *value) {
+    MemThreadReleases *list = value;
+    for (int i = list->count - 1; i >= 0; i--)
+        list->release[i](list->slot[i]);
+    free(list);
+}
+
+static void create_thread_releases_key(void) {
+    thread_releases_ready = pthread_key_create(&thread_releases_key, run_thread_releases) == 0;
+}
+
+int mem_thread_at_exit(MemThreadRelease release, void *slot) {
+    pthread_once(&thread_releases_once, create_thread_releases_key);
+    if (!thread_releases_ready) return 0;
+
+    MemThreadReleases *list = pthread_getspecific(thread_releases_key);
+    if (!list) {
+        list = calloc(1, sizeof(MemThreadReleases));
+        if (!list || pthread_setspecific(thread_releases_key, list) != 0) {
+            free(list);
+            return 0;
+        }
+    }
+    for (int i = 0; i < list->count; i++)
+        if (list->slot[i] == slot) return 1;
+    if (list->count == MEM_THREAD_MAX_RELEASES) return 0;
+    list->release[list->count] = release;
+    list->slot[list->count] = slot;
+    list->count++;
+    return 1;
+}
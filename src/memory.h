@@ -8,4 +8,17 @@ void *mem_alloc(size_t size);
 void mem_free(void *ptr);
 void *mem_calloc(size_t num, size_t size);
 
+// Allocation alignée (alignment : puissance de 2, multiple de sizeof(void *))
+// Le bloc doit être libéré avec mem_aligned_free
+void *mem_aligned_alloc(size_t alignment, size_t size);
+void *mem_aligned_calloc(size_t alignment, size_t num, size_t size);
+void mem_aligned_free(void *ptr);
+
+// Tampons propres à un thread (variables __thread agrandies à la demande) :
+// release(slot) est appelé à la sortie du thread appelant, sans quoi chaque
+// thread terminé (vague d'essais du balayage) perd les siens. slot doit rester
+// valide jusque-là ; un même slot n'est enregistré qu'une fois. Retourne 0 en cas d'échec.
+typedef void (*MemThreadRelease)(void *slot);
+int mem_thread_at_exit(MemThreadRelease release, void *slot);
+
 #endif /* MEMORY_H */
\ No newline at end of file
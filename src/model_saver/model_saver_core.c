@@ -4,7 +4,7 @@
 #include <string.h>
 #include <time.h>
 
-// Copier un réseau de neurones
+// Copier un réseau de neurones (structure couche par couche, paramètres en un memcpy)
 static NeuralNetwork *copy_network(NeuralNetwork *original) {
     if (!original) return NULL;
     
@@ -12,6 +12,7 @@ static NeuralNetwork *copy_network(NeuralNetwork *original) {
     if (!copy) return NULL;
     
     copy->num_layers = original->num_layers;
+    copy->arena = NULL;
     copy->layers = malloc(sizeof(Layer*) * copy->num_layers);
     if (!copy->layers) {
         free(copy);
@@ -33,17 +34,22 @@ static NeuralNetwork *copy_network(NeuralNetwork *original) {
             return NULL;
         }
         
-        // Copier les poids
-        for (size_t j = 0; j < new_layer->output_size; j++) {
-            for (size_t k = 0; k < new_layer->input_size; k++) {
-                new_layer->weights[j][k] = orig_layer->weights[j][k];
-            }
-            new_layer->biases[j] = orig_layer->biases[j];
+        // Sans arène source, copier les paramètres couche par couche
+        if (!original->arena) {
+            memcpy(new_layer->weight_data, orig_layer->weight_data,
+                   orig_layer->output_size * orig_layer->input_size * sizeof(float));
+            memcpy(new_layer->biases, orig_layer->biases, orig_layer->output_size * sizeof(float));
         }
         
         copy->layers[i] = new_layer;
     }
     
+    // Même disposition que l'original : tous les paramètres en une seule copie
+    copy->arena = param_arena_adopt_layers(copy->layers, copy->num_layers);
+    if (original->arena) {
+        param_arena_copy_params(copy->arena, original->arena);
+    }
+    
     return copy;
 }
 
@@ -163,6 +163,7 @@ NeuralNetwork *model_saver_load_h5(const char *filepath, ModelMetadata *metadata
     }
     
     network->num_layers = num_layers;
+    network->arena = NULL;
     network->layers = malloc(sizeof(Layer*) * num_layers);
     if (!network->layers) {
         free(network);
@@ -319,6 +320,9 @@ NeuralNetwork *model_saver_load_h5(const char *filepath, ModelMetadata *metadata
         metadata->activation_names = NULL;
     }
     
+    // Regrouper les paramètres chargés dans l'arène du réseau
+    network->arena = param_arena_adopt_layers(network->layers, network->num_layers);
+    
     fclose(file);
     return network;
 } 
\ No newline at end of file
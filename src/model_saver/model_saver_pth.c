@@ -1,5 +1,6 @@
 #include "model_saver.h"
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -66,13 +67,11 @@ int model_saver_save_pth(const SavedModel *model, const char *filepath) {
             return -1;
         }
         
-        // Écrire les poids
-        for (size_t j = 0; j < layer->output_size; j++) {
-            if (fwrite(layer->weights[j], sizeof(float), 
-                      layer->input_size, file) != layer->input_size) {
-                fclose(file);
-                return -1;
-            }
+        // Écrire les poids (bloc contigu output_size x input_size)
+        size_t weight_count = layer->output_size * layer->input_size;
+        if (fwrite(layer->weight_data, sizeof(float), weight_count, file) != weight_count) {
+            fclose(file);
+            return -1;
         }
         
         // Écrire les biais
@@ -143,6 +142,7 @@ NeuralNetwork *model_saver_load_pth(const char *filepath, ModelMetadata *metadat
     }
     
     network->num_layers = header.num_layers;
+    network->arena = NULL;
     network->layers = malloc(sizeof(Layer*) * network->num_layers);
     if (!network->layers) {
         free(network);
@@ -178,19 +178,17 @@ NeuralNetwork *model_saver_load_pth(const char *filepath, ModelMetadata *metadat
             return NULL;
         }
         
-        // Charger les poids
-        for (size_t j = 0; j < layer->output_size; j++) {
-            if (fread(layer->weights[j], sizeof(float), 
-                     layer->input_size, file) != layer->input_size) {
-                layer_free(layer);
-                for (size_t k = 0; k < i; k++) {
-                    layer_free(network->layers[k]);
-                }
-                free(network->layers);
-                free(network);
-                fclose(file);
-                return NULL;
+        // Charger les poids (bloc contigu output_size x input_size)
+        size_t weight_count = layer->output_size * layer->input_size;
+        if (fread(layer->weight_data, sizeof(float), weight_count, file) != weight_count) {
+            layer_free(layer);
+            for (size_t k = 0; k < i; k++) {
+                layer_free(network->layers[k]);
             }
+            free(network->layers);
+            free(network);
+            fclose(file);
+            return NULL;
         }
         
         // Charger les biais
@@ -216,6 +214,9 @@ NeuralNetwork *model_saver_load_pth(const char *filepath, ModelMetadata *metadat
         network->layers[i] = layer;
     }
     
+    // Regrouper les paramètres chargés dans l'arène du réseau
+    network->arena = param_arena_adopt_layers(network->layers, network->num_layers);
+    
     fclose(file);
     return network;
 } 
\ No newline at end of file
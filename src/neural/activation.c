@@ -1,39 +1,222 @@
 #include "activation.h"
 #include <string.h>
 #include <math.h>
+#include "../math_utils.h"
 
-int get_activation_type(const char *name) {
-    if (strcmp(name, "relu") == 0) return ACTIVATION_RELU;
-    if (strcmp(name, "sigmoid") == 0) return ACTIVATION_SIGMOID;
-    if (strcmp(name, "gelu") == 0) return ACTIVATION_GELU;
-    if (strcmp(name, "neuroplast") == 0) return ACTIVATION_NEUROPLAST;
-    if (strcmp(name, "leaky_relu") == 0) return ACTIVATION_LEAKY_RELU;
-    if (strcmp(name, "elu") == 0) return ACTIVATION_ELU;
-    if (strcmp(name, "mish") == 0) return ACTIVATION_MISH;
-    if (strcmp(name, "swish") == 0) return ACTIVATION_SWISH;
-    if (strcmp(name, "prelu") == 0) return ACTIVATION_PRELU;
-    if (strcmp(name, "tanh") == 0) return ACTIVATION_TANH;
-    if (strcmp(name, "linear") == 0) return ACTIVATION_LINEAR;
-    return ACTIVATION_RELU; // Par défaut
+// ============================================================================
+// NOYAUX ÉLÉMENTAIRES (sans branchement, vectorisables)
+// ============================================================================
+
+#define GELU_K 0.7978845608f   // sqrt(2/π)
+
+static inline float act_relu(float x) { return x > 0.0f ? x : 0.0f; }
+static inline float act_leaky(float x) { return x > 0.0f ? x : 0.01f * x; }
+static inline float act_elu(float x) { return x > 0.0f ? x : approx_exp(x) - 1.0f; }
+
+// GELU (approximation tanh) : 0.5x(1 + tanh(u)) = x * sigmoid(2u)
+static inline float act_gelu(float x) {
+    float u = GELU_K * (x + 0.044715f * x * x * x);
+    return x * approx_sigmoid(2.0f * u);
+}
+
+// tanh(softplus(x)) = n / (n + 2) avec n = e^x (e^x + 2) : ni log1p ni tanh
+static inline float tanh_softplus(float x) {
+    float e = approx_exp(x < 20.0f ? x : 20.0f);
+    float n = e * (e + 2.0f);
+    return n / (n + 2.0f);
 }
 
-float relu(float x) { return x > 0 ? x : 0; }
+static inline float act_mish(float x) { return x * tanh_softplus(x); }
+static inline float act_swish(float x) { return x * approx_sigmoid(x); }
+
+// NeuroPlast adaptatif : ReLU au-dessus de 1, Tanh sous -1, mélange entre les deux
+static inline float act_neuroplast_mix(float x) {
+    float t = approx_tanh(x);
+    float mixed = x < -1.0f ? t : 0.5f * (x + t);
+    return x > 1.0f ? x : mixed;
+}
+
+static inline float act_neuroplast_param(float x, const NeuroPlastParams *p) {
+    float d = x - p->beta;
+    float sigmoid_part = approx_sigmoid(p->alpha * d);
+    float gaussian_plateau = p->gamma * approx_exp(-(d * d) / (p->delta * p->delta));
+    return sigmoid_part * gaussian_plateau;
+}
+
+float relu(float x) { return act_relu(x); }
 float leaky_relu(float x, float alpha) { return x > 0 ? x : alpha * x; }
-float sigmoid(float x) { return 1.0f / (1.0f + expf(-x)); }
-float gelu(float x) { return 0.5f * x * (1.0f + tanhf(0.79788456f * (x + 0.044715f * x * x * x))); }
-float elu(float x, float alpha) { return x > 0 ? x : alpha * (expf(x) - 1.0f); }
-float mish(float x) { return x * tanhf(log1pf(expf(x))); }
-float swish(float x) { return x * sigmoid(x); }
+float sigmoid(float x) { return approx_sigmoid(x); }
+float gelu(float x) { return act_gelu(x); }
+float elu(float x, float alpha) { return x > 0 ? x : alpha * (approx_exp(x) - 1.0f); }
+float mish(float x) { return act_mish(x); }
+float swish(float x) { return act_swish(x); }
 float prelu(float x, float alpha) { return x > 0 ? x : alpha * x; }
 float neuroplast(float x, NeuroPlastParams *p) {
     // Utiliser les paramètres alpha, beta, gamma, delta définis dans neuroplast.h
     // alpha = slope, beta = shift, gamma = plateau_height, delta = plateau_width
-    float slope = p->alpha;
-    float shift = p->beta;
-    float plateau_height = p->gamma;
-    float plateau_width = p->delta;
-    
-    float sigmoid_part = 1.0f / (1.0f + expf(-slope * (x - shift)));
-    float gaussian_plateau = plateau_height * expf(-((x - shift) * (x - shift)) / (plateau_width * plateau_width));
-    return sigmoid_part * gaussian_plateau;
-}
\ No newline at end of file
+    return act_neuroplast_param(x, p);
+}
+
+// ============================================================================
+// FORMULES PAR ACTIVATION (un triplet par entrée de ACTIVATION_LIST)
+// ============================================================================
+// fwd_<nom>(x)      : f(x)
+// dout_<nom>(y)     : f'(.) exprimée à partir de la sortie y = f(x)
+// fwdd_<nom>(x, &d) : f(x) et sa dérivée exacte f'(x), en partageant les calculs
+
+static inline float fwd_relu(float x) { return act_relu(x); }
+static inline float dout_relu(float y) { return y > 0.0f ? 1.0f : 0.0f; }
+static inline float fwdd_relu(float x, float *d) { float y = fwd_relu(x); *d = dout_relu(y); return y; }
+
+static inline float fwd_sigmoid(float x) { return approx_sigmoid(x); }
+static inline float dout_sigmoid(float y) { return y * (1.0f - y); }
+static inline float fwdd_sigmoid(float x, float *d) { float y = fwd_sigmoid(x); *d = dout_sigmoid(y); return y; }
+
+static inline float fwd_tanh(float x) { return approx_tanh(x); }
+static inline float dout_tanh(float y) { return 1.0f - y * y; }
+static inline float fwdd_tanh(float x, float *d) { float y = fwd_tanh(x); *d = dout_tanh(y); return y; }
+
+static inline float fwd_leaky_relu(float x) { return act_leaky(x); }
+static inline float dout_leaky_relu(float y) { return y > 0.0f ? 1.0f : 0.01f; }
+static inline float fwdd_leaky_relu(float x, float *d) { float y = fwd_leaky_relu(x); *d = dout_leaky_relu(y); return y; }
+
+// PReLU avec α = 0.01 (identique à Leaky ReLU tant que α n'est pas appris)
+static inline float fwd_prelu(float x) { return act_leaky(x); }
+static inline float dout_prelu(float y) { return y > 0.0f ? 1.0f : 0.01f; }
+static inline float fwdd_prelu(float x, float *d) { float y = fwd_prelu(x); *d = dout_prelu(y); return y; }
+
+static inline float fwd_linear(float x) { return x; }
+static inline float dout_linear(float y) { (void)y; return 1.0f; }
+static inline float fwdd_linear(float x, float *d) { *d = 1.0f; return x; }
+
+// ELU : sortie = e^x - 1, donc e^x = sortie + 1
+static inline float fwd_elu(float x) { return act_elu(x); }
+static inline float dout_elu(float y) { return y > 0.0f ? 1.0f : y + 1.0f; }
+static inline float fwdd_elu(float x, float *d) { float y = fwd_elu(x); *d = dout_elu(y); return y; }
+
+// GELU, Mish, Swish et NeuroPlast ne se dérivent pas à partir de la sortie :
+// dout_* évalue une approximation sur y, fwdd_* donne la dérivée exacte en z.
+
+// GELU : f = x s avec s = sigmoid(2u), u = k (x + 0.044715 x³)
+// f' = s + x s (1 - s) 2k (1 + 3 * 0.044715 x²)
+static inline float fwd_gelu(float x) { return act_gelu(x); }
+static inline float dout_gelu(float y) { return approx_sigmoid(2.0f * GELU_K * (y + 0.044715f * y * y * y)); }
+static inline float fwdd_gelu(float x, float *d) {
+    float s = approx_sigmoid(2.0f * GELU_K * (x + 0.044715f * x * x * x));
+    *d = s + x * s * (1.0f - s) * (2.0f * GELU_K) * (1.0f + 0.134145f * x * x);
+    return x * s;
+}
+
+// Mish : f = x t avec t = tanh(softplus(x)) = n / (n + 2), n = e^x (e^x + 2)
+// f' = t + x sigmoid(x) (1 - t²), avec 1 - t² = 4 (n + 1) / (n + 2)²
+static inline float fwd_mish(float x) { return act_mish(x); }
+static inline float dout_mish(float y) { return tanh_softplus(y); }
+static inline float fwdd_mish(float x, float *d) {
+    float e = approx_exp(x < 20.0f ? x : 20.0f);
+    float n = e * (e + 2.0f);
+    float inv = 1.0f / (n + 2.0f);
+    float t = n * inv;
+    float sig = e / (1.0f + e);
+    *d = t + x * sig * 4.0f * (n + 1.0f) * inv * inv;
+    return x * t;
+}
+
+// Swish : f = x s, f' = s (1 + x (1 - s))
+static inline float fwd_swish(float x) { return act_swish(x); }
+static inline float dout_swish(float y) {
+    float s = approx_sigmoid(y);
+    return s * (1.0f + y * (1.0f - s));
+}
+static inline float fwdd_swish(float x, float *d) {
+    float s = approx_sigmoid(x);
+    *d = s * (1.0f + x * (1.0f - s));
+    return x * s;
+}
+
+// NeuroPlast adaptatif : 1 au-dessus de 1, 1 - t² sous -1, 1 - t²/2 entre les deux
+static inline float fwd_neuroplast(float x) { return act_neuroplast_mix(x); }
+static inline float dout_neuroplast(float y) {
+    float tanh_branch = y < -1.0f ? 1.0f - y * y : 1.0f - 0.5f * y * y;
+    return y > 1.0f ? 1.0f : tanh_branch;
+}
+static inline float fwdd_neuroplast(float x, float *d) {
+    float t = approx_tanh(x);
+    float mixed = x < -1.0f ? t : 0.5f * (x + t);
+    float mixed_d = x < -1.0f ? 1.0f - t * t : 1.0f - 0.5f * t * t;
+    *d = x > 1.0f ? 1.0f : mixed_d;
+    return x > 1.0f ? x : mixed;
+}
+
+// ============================================================================
+// NOYAUX SUR TABLEAUX GÉNÉRÉS PAR X-MACRO
+// ============================================================================
+// Chaque activation a ses propres boucles : aucun branchement sur le type ni
+// appel indirect dans la boucle, que GCC vectorise entièrement.
+
+#define DEFINE_ACTIVATION_KERNELS(type, label, name, cached) \
+    static void forward_##name(const float *src, float *dst, size_t n) { \
+        for (size_t i = 0; i < n; i++) dst[i] = fwd_##name(src[i]); \
+    } \
+    static void forward_derivative_##name(const float *src, float *dst, float *deriv, size_t n) { \
+        for (size_t i = 0; i < n; i++) { float d; dst[i] = fwdd_##name(src[i], &d); deriv[i] = d; } \
+    } \
+    static void derivative_##name(const float *src, float *dst, size_t n) { \
+        for (size_t i = 0; i < n; i++) dst[i] = dout_##name(src[i]); \
+    } \
+    static void backward_##name(const float *src, float *dst, size_t n) { \
+        for (size_t i = 0; i < n; i++) dst[i] *= dout_##name(src[i]); \
+    }
+
+ACTIVATION_LIST(DEFINE_ACTIVATION_KERNELS)
+#undef DEFINE_ACTIVATION_KERNELS
+
+#define ACTIVATION_TABLE_ENTRY(type, label, name, cached) \
+    [type] = { type, label, cached, forward_##name, forward_derivative_##name, \
+               derivative_##name, backward_##name },
+
+static const ActivationKernels activation_table[ACTIVATION_COUNT] = {
+    ACTIVATION_LIST(ACTIVATION_TABLE_ENTRY)
+};
+#undef ACTIVATION_TABLE_ENTRY
+
+const ActivationKernels *activation_kernels(activation_type_t type) {
+    // Type inconnu : NeuroPlast adaptatif (comportement historique du réseau simple)
+    if (type < 0 || type >= ACTIVATION_COUNT) type = ACTIVATION_NEUROPLAST;
+    return &activation_table[type];
+}
+
+int get_activation_type(const char *name) {
+    for (int type = 0; type < ACTIVATION_COUNT; type++) {
+        if (strcmp(name, activation_table[type].name) == 0) return type;
+    }
+    return ACTIVATION_RELU; // Par défaut
+}
+
+void activation_forward_array(activation_type_t type, const float *z, float *out, size_t n) {
+    activation_kernels(type)->forward(z, out, n);
+}
+
+void activation_derivative_array(activation_type_t type, const float *out, float *deriv, size_t n) {
+    activation_kernels(type)->derivative(out, deriv, n);
+}
+
+void activation_backward_array(activation_type_t type, const float *out, float *delta, size_t n) {
+    activation_kernels(type)->backward(out, delta, n);
+}
+
+float activation_apply(activation_type_t type, float x) {
+    float out;
+    activation_kernels(type)->forward(&x, &out, 1);
+    return out;
+}
+
+float activation_derivative_from_output(activation_type_t type, float out) {
+    float deriv;
+    activation_kernels(type)->derivative(&out, &deriv, 1);
+    return deriv;
+}
+
+void neuroplast_forward_array(const NeuroPlastParams *params, const float *z, float *out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = act_neuroplast_param(z[i], &params[i]);
+}
@@ -1,6 +1,7 @@
 #ifndef ACTIVATION_H
 #define ACTIVATION_H
 
+#include <stddef.h>
 #include "neuroplast.h"  // Inclure pour NeuroPlastParams
 
 // Types d'activation
@@ -16,6 +17,24 @@
 #define ACTIVATION_TANH 9
 #define ACTIVATION_LINEAR 10
 #define ACTIVATION_UNKNOWN -1
+#define ACTIVATION_COUNT 11
+
+// X-macro : X(type, nom de configuration, suffixe des noyaux, dérivée en cache).
+// Chaque entrée génère ses noyaux avant/dérivée dans activation.c et sa ligne
+// de la table. « Dérivée en cache » = 1 quand f'(z) ne se déduit pas de la
+// sortie : la passe avant la conserve pour la rétropropagation.
+#define ACTIVATION_LIST(X) \
+    X(ACTIVATION_RELU,       "relu",       relu,       0) \
+    X(ACTIVATION_SIGMOID,    "sigmoid",    sigmoid,    0) \
+    X(ACTIVATION_GELU,       "gelu",       gelu,       1) \
+    X(ACTIVATION_NEUROPLAST, "neuroplast", neuroplast, 1) \
+    X(ACTIVATION_LEAKY_RELU, "leaky_relu", leaky_relu, 0) \
+    X(ACTIVATION_ELU,        "elu",        elu,        0) \
+    X(ACTIVATION_MISH,       "mish",       mish,       1) \
+    X(ACTIVATION_SWISH,      "swish",      swish,      1) \
+    X(ACTIVATION_PRELU,      "prelu",      prelu,      0) \
+    X(ACTIVATION_TANH,       "tanh",       tanh,       0) \
+    X(ACTIVATION_LINEAR,     "linear",     linear,     0)
 
 // Typedef pour le type d'activation
 typedef int activation_type_t;
@@ -31,6 +50,44 @@ float swish(float x);
 float prelu(float x, float alpha);
 float neuroplast(float x, NeuroPlastParams *params);
 
+// ============================================================================
+// NOYAUX SUR TABLEAUX (approximations polynomiales vectorisées, voir math_utils.h)
+// ============================================================================
+// Un appel traite n éléments ; source et destination peuvent être le même tableau.
+// ACTIVATION_NEUROPLAST (et tout type inconnu) : mélange adaptatif ReLU/Tanh.
+
+typedef void (*ActivationArrayFn)(const float *src, float *dst, size_t n);
+typedef void (*ActivationForwardDerivFn)(const float *src, float *dst, float *deriv, size_t n);
+
+// Noyaux spécialisés d'une activation, à sélectionner une fois par couche
+typedef struct {
+    activation_type_t type;
+    const char *name;
+    int caches_derivative;          // 1 = utiliser forward_derivative et garder f'(z)
+    ActivationArrayFn forward;      // dst[i] = f(src[i])
+    ActivationForwardDerivFn forward_derivative;  // dst[i] = f(src[i]), deriv[i] = f'(src[i]) exacte
+    ActivationArrayFn derivative;   // dst[i] = f'(.) à partir de la sortie src[i]
+    ActivationArrayFn backward;     // dst[i] *= f'(.) à partir de la sortie src[i]
+} ActivationKernels;
+
+const ActivationKernels *activation_kernels(activation_type_t type);
+
+// out[i] = f(z[i])
+void activation_forward_array(activation_type_t type, const float *z, float *out, size_t n);
+
+// deriv[i] = f'(.) exprimée à partir de la sortie out[i] de l'activation
+void activation_derivative_array(activation_type_t type, const float *out, float *deriv, size_t n);
+
+// delta[i] *= f'(.) à partir de out[i] (rétropropagation sans tampon intermédiaire)
+void activation_backward_array(activation_type_t type, const float *out, float *delta, size_t n);
+
+// Versions élément par élément des deux noyaux (même formule)
+float activation_apply(activation_type_t type, float x);
+float activation_derivative_from_output(activation_type_t type, float out);
+
+// NeuroPlast paramétrique : out[i] = neuroplast(z[i], &params[i])
+void neuroplast_forward_array(const NeuroPlastParams *params, const float *z, float *out, size_t n);
+
 // Conversion nom -> type
 int get_activation_type(const char *name);
 
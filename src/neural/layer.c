@@ -4,29 +4,6 @@
 #include <time.h>
 #include "activation.h"
 
-// Générateur de nombres aléatoires pour distribution normale (Box-Muller)
-static float box_muller_normal(float mean, float std) {
-    static int has_spare = 0;
-    static float spare;
-    
-    if (has_spare) {
-        has_spare = 0;
-        return spare * std + mean;
-    }
-    
-    has_spare = 1;
-    float u, v, mag;
-    do {
-        u = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-        v = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-        mag = u * u + v * v;
-    } while (mag >= 1.0f || mag == 0.0f);
-    
-    mag = sqrtf(-2.0f * logf(mag) / mag);
-    spare = v * mag;
-    return u * mag * std + mean;
-}
-
 Layer *layer_create(size_t input_size, size_t output_size, int activation_type) {
     Layer *layer = malloc(sizeof(Layer));
     if (!layer) return NULL;
@@ -34,61 +11,41 @@ Layer *layer_create(size_t input_size, size_t output_size, int activation_type)
     layer->input_size = input_size;
     layer->output_size = output_size;
     layer->activation_type = activation_type;
+    layer->kernels = activation_kernels(activation_type);
+    layer->derivatives = NULL;
+    layer->grad_weights = NULL;
+    layer->grad_biases = NULL;
+    layer->weight_offset = 0;
+    layer->bias_offset = 0;
+    layer->params_in_arena = 0;
 
-    // Allocation des poids
+    // Allocation des poids : un seul bloc contigu, weights[i] pointe sur la ligne i.
+    // Poids à zéro : chaque appelant les initialise (init_weights_simple,
+    // init_weights_advanced) ou les charge (model_saver) juste après.
     layer->weights = malloc(output_size * sizeof(float *));
-    if (!layer->weights) {
+    layer->weight_data = calloc(output_size * input_size, sizeof(float));
+    if (!layer->weights || !layer->weight_data) {
+        free(layer->weights);
+        free(layer->weight_data);
         free(layer);
         return NULL;
     }
     
     for (size_t i = 0; i < output_size; i++) {
-        layer->weights[i] = malloc(input_size * sizeof(float));
-        if (!layer->weights[i]) {
-            for (size_t j = 0; j < i; j++) {
-                free(layer->weights[j]);
-            }
-            free(layer->weights);
-            free(layer);
-            return NULL;
-        }
-        
-        // Initialisation améliorée des poids selon l'activation
-        float std;
-        switch (activation_type) {
-            case ACTIVATION_RELU:
-            case ACTIVATION_LEAKY_RELU:
-            case ACTIVATION_ELU:
-            case ACTIVATION_PRELU:
-                // He initialization pour ReLU et variantes
-                std = sqrtf(2.0f / input_size);
-                break;
-            case ACTIVATION_SIGMOID:
-            case ACTIVATION_GELU:
-            case ACTIVATION_MISH:
-            case ACTIVATION_SWISH:
-                // Xavier/Glorot pour sigmoid et variantes
-                std = sqrtf(1.0f / input_size);
-                break;
-            case ACTIVATION_NEUROPLAST:
-                // Initialisation spéciale pour NeuroPlast
-                std = sqrtf(2.0f / (input_size + output_size));
-                break;
-            default:
-                // Xavier/Glorot par défaut
-                std = sqrtf(2.0f / (input_size + output_size));
-                break;
-        }
-        
-        for (size_t j = 0; j < input_size; j++) {
-            layer->weights[i][j] = box_muller_normal(0.0f, std);
-        }
+        layer->weights[i] = layer->weight_data + i * input_size;
     }
 
     // Allocation et initialisation des autres composants
     layer->biases = calloc(output_size, sizeof(float));
     layer->outputs = calloc(output_size, sizeof(float));
     layer->deltas = calloc(output_size, sizeof(float));
+    if (layer->kernels->caches_derivative) {
+        layer->derivatives = calloc(output_size, sizeof(float));
+        if (!layer->derivatives) {
+            layer_free(layer);
+            return NULL;
+        }
+    }
     
     if (!layer->biases || !layer->outputs || !layer->deltas) {
         layer_free(layer);
@@ -115,18 +72,16 @@ Layer *layer_create(size_t input_size, size_t output_size, int activation_type)
 void layer_free(Layer *layer) {
     if (!layer) return;
     
-    if (layer->weights) {
-        for (size_t i = 0; i < layer->output_size; i++) {
-            if (layer->weights[i]) {
-                free(layer->weights[i]);
-            }
-        }
-        free(layer->weights);
-    }
+    if (layer->weights) free(layer->weights);
     
-    if (layer->biases) free(layer->biases);
+    // Les poids et biais d'une couche rattachée à une arène sont libérés avec l'arène
+    if (!layer->params_in_arena) {
+        if (layer->weight_data) free(layer->weight_data);
+        if (layer->biases) free(layer->biases);
+    }
     if (layer->outputs) free(layer->outputs);
     if (layer->deltas) free(layer->deltas);
+    if (layer->derivatives) free(layer->derivatives);
     if (layer->np_params) free(layer->np_params);
     free(layer);
 }
@@ -142,45 +97,20 @@ void layer_forward(Layer *layer, float *input) {
             z += layer->weights[i][j] * input[j];
         }
         
-        // Application de la fonction d'activation
-        switch (layer->activation_type) {
-            case ACTIVATION_RELU: 
-                layer->outputs[i] = relu(z); 
-                break;
-            case ACTIVATION_SIGMOID: 
-                layer->outputs[i] = sigmoid(z); 
-                break;
-            case ACTIVATION_GELU: 
-                layer->outputs[i] = gelu(z); 
-                break;
-            case ACTIVATION_NEUROPLAST: 
-                // Vérification de sécurité pour les paramètres neuroplast
-                if (layer->np_params) {
-                    layer->outputs[i] = neuroplast(z, &layer->np_params[i]); 
-                } else {
-                    // Fallback vers sigmoid si paramètres non initialisés
-                    layer->outputs[i] = sigmoid(z);
-                }
-                break;
-            case ACTIVATION_LEAKY_RELU: 
-                layer->outputs[i] = leaky_relu(z, 0.01f); 
-                break;
-            case ACTIVATION_ELU: 
-                layer->outputs[i] = elu(z, 1.0f); 
-                break;
-            case ACTIVATION_MISH: 
-                layer->outputs[i] = mish(z); 
-                break;
-            case ACTIVATION_SWISH: 
-                layer->outputs[i] = swish(z); 
-                break;
-            case ACTIVATION_PRELU: 
-                layer->outputs[i] = prelu(z, 0.01f); 
-                break;
-            default: 
-                layer->outputs[i] = z;
-                break;
+        layer->outputs[i] = z;
+    }
+    
+    // Application de la fonction d'activation sur toute la couche
+    if (layer->activation_type == ACTIVATION_NEUROPLAST) {
+        // Vérification de sécurité pour les paramètres neuroplast
+        if (layer->np_params) {
+            neuroplast_forward_array(layer->np_params, layer->outputs, layer->outputs, layer->output_size);
+        } else {
+            // Fallback vers sigmoid si paramètres non initialisés
+            activation_forward_array(ACTIVATION_SIGMOID, layer->outputs, layer->outputs, layer->output_size);
         }
+    } else {
+        layer->kernels->forward(layer->outputs, layer->outputs, layer->output_size);
     }
 }
 
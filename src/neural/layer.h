@@ -3,18 +3,30 @@
 
 #include <stddef.h>
 #include "neuroplast.h"
+#include "activation.h"
 
 typedef struct {
     size_t input_size;
     size_t output_size;
     int activation_type;
-    float **weights;
+    const ActivationKernels *kernels;  // Noyaux avant/arrière de l'activation (choisis à la création)
+    float **weights;        // Pointeurs de lignes : weights[i] = weight_data + i * input_size
+    float *weight_data;     // Bloc contigu output_size x input_size (ordre ligne)
     float *biases;
     float *outputs;
     float *deltas;
+    float *derivatives;     // f'(z) exacte du dernier passage avant (NULL si déduite de la sortie)
     NeuroPlastParams *np_params;
+    
+    // Position dans l'arène de paramètres du réseau (voir param_arena.h)
+    float *grad_weights;    // Gradient des poids (même disposition que weight_data), NULL hors arène
+    float *grad_biases;     // Gradient des biais, NULL hors arène
+    size_t weight_offset;   // Décalage de weight_data dans l'arène
+    size_t bias_offset;     // Décalage de biases dans l'arène
+    int params_in_arena;    // 1 = weight_data/biases appartiennent à l'arène (ne pas les libérer)
 } Layer;
 
+// Poids et biais à zéro : à initialiser (ou charger) par l'appelant
 Layer *layer_create(size_t input_size, size_t output_size, int activation_type);
 void layer_free(Layer *layer);
 void layer_forward(Layer *layer, float *input);
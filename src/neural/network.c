@@ -1,6 +1,7 @@
 #include "network.h"
 #include "activation.h"
 #include "../colored_output.h"
+#include "../rng.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
@@ -20,6 +21,7 @@ typedef struct {
 typedef struct {
     size_t num_layers;
     Layer **layers;
+    ParamArena *arena;                 // Arène de paramètres (préfixe commun avec NeuralNetwork)
     ActivationMix *activation_mixes;   // Nouveau: mélange d'activations par couche
     float *batch_norm_mean;            // Nouveau: moyennes pour normalisation batch
     float *batch_norm_var;             // Nouveau: variances pour normalisation batch
@@ -28,10 +30,11 @@ typedef struct {
     float dropout_rate;                // Nouveau: taux de dropout adaptatif
     int use_batch_norm;                // Nouveau: flag pour normalisation batch
     int use_residual;                  // Nouveau: flag pour connexions résiduelles
+    Rng rng;                           // Tirages du réseau : initialisation et dropout
 } EnhancedNeuralNetwork;
 
 // Initialisation avancée des poids avec différentes méthodes
-static void init_weights_advanced(Layer *layer, int method) {
+static void init_weights_advanced(Layer *layer, int method, Rng *rng) {
     float fan_in = (float)layer->input_size;
     float fan_out = (float)layer->output_size;
     float std = 0.1f;
@@ -42,8 +45,7 @@ static void init_weights_advanced(Layer *layer, int method) {
                 float limit = sqrtf(6.0f / (fan_in + fan_out));
                 for (size_t i = 0; i < layer->output_size; i++) {
                     for (size_t j = 0; j < layer->input_size; j++) {
-                        float u1 = (float)rand() / RAND_MAX;
-                        layer->weights[i][j] = (2.0f * u1 - 1.0f) * limit;
+                        layer->weights[i][j] = (2.0f * rng_uniform(rng) - 1.0f) * limit;
                     }
                 }
             }
@@ -63,34 +65,41 @@ static void init_weights_advanced(Layer *layer, int method) {
     }
     
     if (method != 0) { // Pour les méthodes normales (non uniformes)
+        // Box-Muller du générateur du réseau (second tirage gardé dans rng)
         for (size_t i = 0; i < layer->output_size; i++) {
             for (size_t j = 0; j < layer->input_size; j++) {
-                // Box-Muller pour distribution normale
-                static int has_spare = 0;
-                static float spare;
-                if (has_spare) {
-                    has_spare = 0;
-                    layer->weights[i][j] = spare * std;
-                } else {
-                    has_spare = 1;
-                    float u, v, mag;
-                    do {
-                        u = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-                        v = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-                        mag = u * u + v * v;
-                    } while (mag >= 1.0f || mag == 0.0f);
-                    mag = sqrtf(-2.0f * logf(mag) / mag);
-                    spare = v * mag;
-                    layer->weights[i][j] = u * mag * std;
-                }
+                layer->weights[i][j] = rng_normal(rng) * std;
             }
         }
     }
 }
 
+// Noyau d'un neurone du mélange, avec les replis propres à ce réseau : NeuroPlast
+// sans paramètres devient sigmoid, et les types hors de la liste historique
+// (prelu, tanh, linear, inconnus) restent l'identité (NULL)
+static const ActivationKernels *mixed_activation_kernels(activation_type_t type) {
+    switch (type) {
+        case ACTIVATION_RELU:
+        case ACTIVATION_SIGMOID:
+        case ACTIVATION_GELU:
+        case ACTIVATION_LEAKY_RELU:
+        case ACTIVATION_ELU:
+        case ACTIVATION_MISH:
+        case ACTIVATION_SWISH:
+            return activation_kernels(type);
+        case ACTIVATION_NEUROPLAST:
+            return activation_kernels(ACTIVATION_SIGMOID);
+        default:
+            return NULL;
+    }
+}
+
+// Taille du tampon de regroupement (pile) : au-delà, un résidu est traité en plusieurs appels
+#define MIXED_ACTIVATION_CHUNK 256
+
 // Fonctions d'activations mélangées pour une couche
 static void apply_mixed_activations(Layer *layer, float *inputs, ActivationMix *mix) {
-    if (!mix || !mix->activation_mix) {
+    if (!mix || !mix->activation_mix || mix->mix_size == 0) {
         // Fallback vers activation unique
         layer_forward(layer, inputs);
         return;
@@ -104,41 +113,35 @@ static void apply_mixed_activations(Layer *layer, float *inputs, ActivationMix *
             z += layer->weights[i][j] * inputs[j];
         }
         
-        // Application de l'activation spécifique au neurone
-        activation_type_t act_type = mix->activation_mix[i % mix->mix_size];
+        layer->outputs[i] = z;
+    }
+    
+    // Le neurone i prend l'activation activation_mix[i % mix_size] : les neurones d'un
+    // même résidu sont regroupés (pas de mix_size) dans un tampon contigu, activés par
+    // un seul appel au noyau vectorisé, puis remis en place
+    float group[MIXED_ACTIVATION_CHUNK];
+    for (size_t k = 0; k < mix->mix_size && k < layer->output_size; k++) {
+        activation_type_t type = mix->activation_mix[k];
+        if (type == ACTIVATION_NEUROPLAST && layer->np_params) {
+            // NeuroPlast paramétrique : paramètres propres à chaque neurone
+            for (size_t i = k; i < layer->output_size; i += mix->mix_size) {
+                layer->outputs[i] = neuroplast(layer->outputs[i], &layer->np_params[i]);
+            }
+            continue;
+        }
+        const ActivationKernels *kernels = mixed_activation_kernels(type);
+        if (!kernels) continue;
         
-        switch (act_type) {
-            case ACTIVATION_RELU: 
-                layer->outputs[i] = fmaxf(0.0f, z); 
-                break;
-            case ACTIVATION_SIGMOID: 
-                layer->outputs[i] = 1.0f / (1.0f + expf(-z)); 
-                break;
-            case ACTIVATION_GELU: 
-                layer->outputs[i] = 0.5f * z * (1.0f + tanhf(sqrtf(2.0f / M_PI) * (z + 0.044715f * z * z * z))); 
-                break;
-            case ACTIVATION_LEAKY_RELU: 
-                layer->outputs[i] = (z > 0) ? z : 0.01f * z; 
-                break;
-            case ACTIVATION_ELU: 
-                layer->outputs[i] = (z > 0) ? z : 1.0f * (expf(z) - 1.0f); 
-                break;
-            case ACTIVATION_MISH: 
-                layer->outputs[i] = z * tanhf(log1pf(expf(z))); 
-                break;
-            case ACTIVATION_SWISH: 
-                layer->outputs[i] = z / (1.0f + expf(-z)); 
-                break;
-            case ACTIVATION_NEUROPLAST:
-                if (layer->np_params) {
-                    layer->outputs[i] = neuroplast(z, &layer->np_params[i % layer->output_size]); 
-                } else {
-                    layer->outputs[i] = 1.0f / (1.0f + expf(-z)); // fallback sigmoid
-                }
-                break;
-            default: 
-                layer->outputs[i] = z;
-                break;
+        size_t i = k;
+        while (i < layer->output_size) {
+            size_t count = 0;
+            for (size_t g = i; g < layer->output_size && count < MIXED_ACTIVATION_CHUNK; g += mix->mix_size) {
+                group[count++] = layer->outputs[g];
+            }
+            kernels->forward(group, group, count);
+            for (size_t c = 0; c < count; c++, i += mix->mix_size) {
+                layer->outputs[i] = group[c];
+            }
         }
     }
 }
@@ -185,7 +188,7 @@ static void apply_batch_normalization(float *outputs, float *mean, float *var,
 
 // Dropout adaptatif
 static void apply_adaptive_dropout(float *outputs, size_t size, float base_rate, 
-                                  float epoch_factor, int training) {
+                                  float epoch_factor, int training, Rng *rng) {
     if (!training) return;
     
     // Dropout rate adaptatif basé sur l'époque
@@ -193,7 +196,7 @@ static void apply_adaptive_dropout(float *outputs, size_t size, float base_rate,
     adaptive_rate = fmaxf(0.1f, fminf(0.8f, adaptive_rate));
     
     for (size_t i = 0; i < size; i++) {
-        if ((float)rand() / RAND_MAX < adaptive_rate) {
+        if (rng_uniform(rng) < adaptive_rate) {
             outputs[i] = 0.0f;
         } else {
             outputs[i] /= (1.0f - adaptive_rate); // Scaling pour maintenir l'espérance
@@ -202,6 +205,11 @@ static void apply_adaptive_dropout(float *outputs, size_t size, float base_rate,
 }
 
 NeuralNetwork *network_create(size_t n_layers, const size_t *layer_sizes, const char **activations) {
+    return network_create_seeded(n_layers, layer_sizes, activations, 0);
+}
+
+NeuralNetwork *network_create_seeded(size_t n_layers, const size_t *layer_sizes,
+                                     const char **activations, uint64_t seed) {
     // Validation des entrées
     if (n_layers < 2) {
         printf("Erreur: un réseau doit avoir au moins 2 couches (entrée et sortie)\n");
@@ -221,9 +229,11 @@ NeuralNetwork *network_create(size_t n_layers, const size_t *layer_sizes, const
     }
     
     net->num_layers = n_layers - 1;
+    net->arena = NULL;
     net->dropout_rate = 0.3f; // Taux de dropout initial
     net->use_batch_norm = 1;  // Activer la normalisation par batch
     net->use_residual = (n_layers > 3) ? 1 : 0; // Connexions résiduelles pour réseaux profonds
+    rng_seed(&net->rng, seed ? seed : rng_seed_from_rand());
     
     // Allocation des couches
     net->layers = malloc((n_layers - 1) * sizeof(Layer*));
@@ -277,7 +287,7 @@ NeuralNetwork *network_create(size_t n_layers, const size_t *layer_sizes, const
         
         // Initialisation avancée des poids selon la couche
         int init_method = (i == 0) ? 1 : (i == n_layers - 2) ? 2 : 0; // He pour première, LeCun pour dernière
-        init_weights_advanced(net->layers[i], init_method);
+        init_weights_advanced(net->layers[i], init_method, &net->rng);
         
         // Créer le mélange d'activations pour cette couche
         net->activation_mixes[i].mix_size = 4; // Utiliser 4 activations différentes
@@ -310,6 +320,9 @@ NeuralNetwork *network_create(size_t n_layers, const size_t *layer_sizes, const
         print_network_info_safe(layer_info);
     }
     
+    // Regrouper tous les paramètres dans l'arène du réseau
+    net->arena = param_arena_adopt_layers(net->layers, net->num_layers);
+    
     print_success_safe("Réseau amélioré créé avec activations mélangées et normalisation batch");
     
     return (NeuralNetwork*)net; // Cast pour compatibilité
@@ -328,6 +341,7 @@ void network_free(NeuralNetwork *net) {
         }
         free(enhanced_net->layers);
     }
+    param_arena_free(enhanced_net->arena);
     
     // Libération des activations mélangées
     if (enhanced_net->activation_mixes) {
@@ -401,7 +415,7 @@ void network_forward(NeuralNetwork *net, float *input) {
         if (i < enhanced_net->num_layers - 1) {
             float epoch_factor = 0.5f; // À adapter selon l'époque courante
             apply_adaptive_dropout(layer->outputs, layer->output_size, 
-                                 enhanced_net->dropout_rate, epoch_factor, 1);
+                                 enhanced_net->dropout_rate, epoch_factor, 1, &enhanced_net->rng);
         }
         
         current_input = layer->outputs;
@@ -2,15 +2,23 @@
 #define NETWORK_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include "layer.h"
+#include "param_arena.h"
 
 typedef struct {
     size_t num_layers;
     Layer **layers;
+    ParamArena *arena;   // Paramètres et gradients de toutes les couches (bloc unique)
 } NeuralNetwork;
 
 NeuralNetwork *network_create(size_t n_layers, const size_t *layer_sizes, const char **activations);
 
+// Initialisation et dropout adaptatif tirés du générateur propre au réseau, ensemencé
+// par seed (graine de l'essai ; 0 = graine dérivée de srand())
+NeuralNetwork *network_create_seeded(size_t n_layers, const size_t *layer_sizes,
+                                     const char **activations, uint64_t seed);
+
 void network_free(NeuralNetwork *net);
 void network_forward(NeuralNetwork *net, float *input);
 void network_backward(NeuralNetwork *net, float *input, float *target, float learning_rate, float class_weight);
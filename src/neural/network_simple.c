@@ -2,10 +2,16 @@
 #include "network_simple.h"
 #include "activation.h"
 #include "../colored_output.h"
+#include "../gemm.h"
+#include "../memory.h"
+#include "../rng.h"
+#include "../thread_pool.h"
+#include "../evaluation/metrics_engine.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include <stdint.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -24,6 +30,7 @@ NetworkConfig create_default_config() {
     config.class_weight_ratio = 15.0f;  // 15x pour classe minoritaire
     config.use_momentum = 1;
     config.use_dropout = 1;
+    config.seed = 0;                    // Graine dérivée de srand()
     return config;
 }
 
@@ -57,13 +64,24 @@ NetworkConfig create_config_for_optimizer(const char *optimizer_name) {
     return config;
 }
 
+// Tampons du mode mini-batch : une ligne par échantillon du lot (ordre ligne)
+typedef struct {
+    size_t capacity;          // Taille de lot pour laquelle les tampons sont alloués
+    float *inputs;            // B x input_size de la première couche
+    float **activations;      // Par couche : B x output_size
+    float **deltas;           // Par couche : B x output_size
+    float **dropout_scale;    // Par couche : B x output_size (0 ou 1/(1-p)), couches cachées
+    float **derivatives;      // Par couche : B x output_size, f'(Z) si la couche la garde en cache
+} BatchWorkspace;
+
 // Structure simplifiée et robuste avec améliorations anti-overfitting
 typedef struct {
     size_t num_layers;
     Layer **layers;
+    ParamArena *arena;          // Paramètres et gradients de toutes les couches (bloc unique)
     float learning_rate;
     float momentum;
-    float **momentum_weights; // Momentum pour SGD avec momentum
+    float *velocity;            // Momentum pour SGD : même disposition que l'arène
     float *momentum_biases;
     int use_momentum;
     
@@ -73,11 +91,23 @@ typedef struct {
     float l2_lambda;           // Coefficient de régularisation L2
     float optimal_threshold;    // Seuil de décision optimal
     int use_dropout;           // Activer/désactiver dropout
-    float *dropout_mask;       // Masque de dropout pour la couche cachée
+    float *dropout_mask;       // Masques de dropout des couches cachées, bout à bout
+    Rng rng;                   // Tirages du réseau : initialisation et dropout
+    
+    // Espace de travail du mode mini-batch (alloué à la demande)
+    BatchWorkspace batch;
+    
+    // Entrées non nulles compactées pour les noyaux creux (taille = couche la plus large)
+    uint32_t *active_index;
+    float *active_value;
+    
+    // Optimiseur externe (optimizers/) appliqué sur l'arène ; NULL = SGD + momentum intégré
+    void *optimizer_state;
+    ParamUpdateFn optimizer_update;
 } SimpleNeuralNetwork;
 
 // Initialisation HE pour ReLU et Xavier pour Sigmoid/Tanh (éprouvée)
-static void init_weights_simple(Layer *layer, activation_type_t activation) {
+static void init_weights_simple(Layer *layer, activation_type_t activation, Rng *rng) {
     float fan_in = (float)layer->input_size;
     float fan_out = (float)layer->output_size;
     float std;
@@ -119,125 +149,125 @@ static void init_weights_simple(Layer *layer, activation_type_t activation) {
             std = sqrtf(2.0f / (fan_in + fan_out));
     }
     
-    // Distribution normale avec Box-Muller
+    // Distribution normale (Box-Muller sur les flux vectoriels du réseau)
+    rng_normal_array(rng, layer->weight_data, layer->output_size * layer->input_size, 0.0f, std);
+    
     for (size_t i = 0; i < layer->output_size; i++) {
-        for (size_t j = 0; j < layer->input_size; j++) {
-            static int has_spare = 0;
-            static float spare;
-            
-            if (has_spare) {
-                has_spare = 0;
-                layer->weights[i][j] = spare * std;
-            } else {
-                has_spare = 1;
-                float u, v, mag;
-                do {
-                    u = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-                    v = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
-                    mag = u * u + v * v;
-                } while (mag >= 1.0f || mag == 0.0f);
-                
-                mag = sqrtf(-2.0f * logf(mag) / mag);
-                spare = v * mag;
-                layer->weights[i][j] = u * mag * std;
-            }
-        }
         // Biais initialisés à zéro pour les couches cachées (sauf cas spéciaux)
         if (activation == ACTIVATION_NEUROPLAST) {
             // NeuroPlast : petit biais aléatoire pour briser la symétrie
-            layer->biases[i] = ((float)rand() / RAND_MAX - 0.5f) * 0.01f;
+            layer->biases[i] = (rng_uniform(rng) - 0.5f) * 0.01f;
         } else {
             layer->biases[i] = 0.0f;
         }
     }
 }
 
-// Activation simple et robuste
-static float apply_activation(float x, activation_type_t type) {
-    switch (type) {
-        case ACTIVATION_RELU:
-            return fmaxf(0.0f, x);
-        case ACTIVATION_SIGMOID:
-            // Protection contre overflow
-            if (x > 500.0f) return 1.0f;
-            if (x < -500.0f) return 0.0f;
-            return 1.0f / (1.0f + expf(-x));
-        case ACTIVATION_TANH:
-            // Protection contre overflow
-            if (x > 500.0f) return 1.0f;
-            if (x < -500.0f) return -1.0f;
-            return tanhf(x);
-        case ACTIVATION_LEAKY_RELU:
-            return (x > 0) ? x : 0.01f * x;
-        case ACTIVATION_LINEAR:
-            return x;
-        // NOUVELLES ACTIVATIONS AJOUTÉES
-        case ACTIVATION_GELU:
-            // GELU approximation: 0.5 * x * (1 + tanh(sqrt(2/π) * (x + 0.044715 * x^3)))
-            return 0.5f * x * (1.0f + tanhf(0.7978845608f * (x + 0.044715f * x * x * x)));
-        case ACTIVATION_MISH:
-            // Mish: x * tanh(ln(1 + e^x))
-            return x * tanhf(logf(1.0f + expf(fminf(x, 20.0f)))); // Protection overflow
-        case ACTIVATION_SWISH:
-            // Swish: x * sigmoid(x)
-            if (x > 500.0f) return x;
-            if (x < -500.0f) return 0.0f;
-            return x / (1.0f + expf(-x));
-        case ACTIVATION_ELU:
-            // ELU: x si x > 0, sinon α(e^x - 1) avec α = 1.0
-            return (x > 0) ? x : (expf(x) - 1.0f);
-        case ACTIVATION_PRELU:
-            // PReLU avec α = 0.01 (peut être fait paramétrable plus tard)
-            return (x > 0) ? x : 0.01f * x;
-        default:
-            // ACTIVATION_NEUROPLAST ou inconnue : utiliser une fonction adaptative
-            // NeuroPlast: mélange adaptatif ReLU/Tanh selon la valeur
-            if (x > 1.0f) return x; // ReLU pour grandes valeurs
-            else if (x < -1.0f) return tanhf(x); // Tanh pour valeurs négatives
-            else return 0.5f * (x + tanhf(x)); // Mélange pour [-1,1]
+// Delta de la couche de sortie avec équilibrage des classes adaptatif
+static float output_delta_simple(const SimpleNeuralNetwork *simple_net, float output, float target_val,
+                                 activation_type_t activation) {
+    float error = target_val - output;
+    
+    // ÉQUILIBRAGE DES CLASSES ADAPTATIF
+    int target_class = (target_val > 0.5f) ? 1 : 0;
+    float base_class_weight = simple_net->class_weights[target_class];
+    
+    // Pondération adaptative : plus de poids pour les erreurs importantes
+    float adaptive_weight = base_class_weight;
+    
+    // Ajustement selon la difficulté de la prédiction
+    if (target_val > 0.5f && output < 0.3f) {
+        adaptive_weight *= 1.8f; // Cas très difficile : vrai positif mal prédit
+    } else if (target_val < 0.5f && output > 0.7f) {
+        adaptive_weight *= 1.5f; // Cas difficile : faux positif
+    } else if (fabsf(target_val - output) > 0.7f) {
+        adaptive_weight *= 1.3f; // Erreur importante
+    }
+    
+    // Delta = erreur pondérée * dérivée de l'activation avec stabilisation
+    float derivative = activation_derivative_from_output(activation, output);
+    // Stabilisation pour éviter les gradients évanescents dans sigmoid
+    if (activation == ACTIVATION_SIGMOID) {
+        derivative = fmaxf(derivative, 0.01f); // Minimum 1% de gradient
     }
+    
+    return error * adaptive_weight * derivative;
 }
 
-// Dérivée de l'activation
-static float activation_derivative(float output, activation_type_t type) {
-    switch (type) {
-        case ACTIVATION_RELU:
-            return (output > 0) ? 1.0f : 0.0f;
-        case ACTIVATION_SIGMOID:
-            return output * (1.0f - output);
-        case ACTIVATION_TANH:
-            return 1.0f - output * output;
-        case ACTIVATION_LEAKY_RELU:
-            return (output > 0) ? 1.0f : 0.01f;
-        case ACTIVATION_LINEAR:
-            return 1.0f;
-        // DÉRIVÉES DES NOUVELLES ACTIVATIONS
-        case ACTIVATION_GELU:
-            // Dérivée approximative de GELU
-            return 0.5f * (1.0f + tanhf(0.7978845608f * (output + 0.044715f * output * output * output)));
-        case ACTIVATION_MISH:
-            // Dérivée approximative de Mish
-            return tanhf(logf(1.0f + expf(fminf(output, 20.0f))));
-        case ACTIVATION_SWISH:
-            // Dérivée de Swish: sigmoid(x) + x * sigmoid(x) * (1 - sigmoid(x))
-            if (output > 500.0f) return 1.0f;
-            if (output < -500.0f) return 0.0f;
-            float sig = 1.0f / (1.0f + expf(-output));
-            return sig + output * sig * (1.0f - sig);
-        case ACTIVATION_ELU:
-            // Dérivée de ELU: 1 si x > 0, sinon α * e^x avec α = 1.0
-            return (output > 0) ? 1.0f : (output + 1.0f); // output = α(e^x - 1), donc e^x = output + 1
-        case ACTIVATION_PRELU:
-            return (output > 0) ? 1.0f : 0.01f;
-        default:
-            // ACTIVATION_NEUROPLAST ou inconnue : dérivée adaptative
-            if (output > 1.0f) return 1.0f; // Dérivée ReLU
-            else if (output < -1.0f) return 1.0f - output * output; // Dérivée Tanh
-            else return 0.5f * (1.0f + (1.0f - output * output)); // Mélange
+// ============================================================================
+// NOYAUX CREUX : sorties ReLU exactement nulles
+// ============================================================================
+// Une entrée nulle n'ajoute rien à W*x : la passe avant ne parcourt que les
+// colonnes actives, listées une fois par couche. Au-delà de 20 % de zéros, le
+// produit indexé bat déjà le produit dense (mesuré sur une couche 1024 → 512 :
+// -10 % à 10 % de zéros, -40 % à 50 %, -75 % à 80 %). En rétropropagation,
+// l'AXPY contigu reste plus rapide qu'un accès indexé : on y saute plutôt les
+// lignes entières dont le delta est nul.
+#define SPARSE_MIN_ZERO_FRACTION 0.2f
+
+// Tampons des indices actifs, dimensionnés pour la couche la plus large.
+// En cas d'échec d'allocation, le réseau reste sur les noyaux denses.
+static void sparse_scratch_alloc(SimpleNeuralNetwork *net, size_t n_layers, const size_t *layer_sizes) {
+    size_t widest = 0;
+    for (size_t i = 0; i < n_layers; i++) {
+        if (layer_sizes[i] > widest) widest = layer_sizes[i];
+    }
+    net->active_index = malloc(widest * sizeof(uint32_t));
+    net->active_value = malloc(widest * sizeof(float));
+    if (!net->active_index || !net->active_value) {
+        free(net->active_index);
+        free(net->active_value);
+        net->active_index = NULL;
+        net->active_value = NULL;
+    }
+}
+
+// Compacter les entrées non nulles de x (indices et valeurs, sans branchement).
+// Retourne leur nombre, ou n si la liste n'est pas assez courte pour être rentable.
+static size_t sparse_collect(const float *x, size_t n, uint32_t *index, float *value) {
+    if (!index) return n;
+
+    size_t count = 0;
+    for (size_t k = 0; k < n; k++) {
+        index[count] = (uint32_t)k;
+        value[count] = x[k];
+        count += x[k] != 0.0f;
+    }
+    return (float)(n - count) >= SPARSE_MIN_ZERO_FRACTION * (float)n ? count : n;
+}
+
+// z = W*x + b. Entrée assez creuse (sortie ReLU) : seules les colonnes actives
+// sont lues, dans le même ordre, donc z est identique au produit dense.
+// index/value : tampons de la taille de l'entrée (NULL = toujours dense).
+static void layer_affine(const Layer *layer, const float *x, float *z, uint32_t *index, float *value) {
+    size_t active = sparse_collect(x, layer->input_size, index, value);
+    if (active < layer->input_size) {
+        for (size_t j = 0; j < layer->output_size; j++) {
+            const float *row = layer->weights[j];
+            float sum = layer->biases[j];
+            for (size_t a = 0; a < active; a++) {
+                sum += row[index[a]] * value[a];
+            }
+            z[j] = sum;
+        }
+    } else {
+        for (size_t j = 0; j < layer->output_size; j++) {
+            const float *row = layer->weights[j];
+            float sum = layer->biases[j];
+            for (size_t k = 0; k < layer->input_size; k++) {
+                sum += row[k] * x[k];
+            }
+            z[j] = sum;
+        }
     }
 }
 
 NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes, const char **activations) {
+    return network_create_simple_seeded(n_layers, layer_sizes, activations, 0);
+}
+
+NeuralNetwork *network_create_simple_seeded(size_t n_layers, const size_t *layer_sizes,
+                                            const char **activations, uint64_t seed) {
     if (n_layers < 2) {
         printf("Erreur: un réseau doit avoir au moins 2 couches\n");
         return NULL;
@@ -261,6 +291,12 @@ NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes,
     net->optimal_threshold = 0.5f;  // Seuil standard
     net->use_dropout = 0;           // Dropout désactivé par défaut
     net->dropout_mask = NULL;
+    rng_seed(&net->rng, seed ? seed : rng_seed_from_rand());
+    memset(&net->batch, 0, sizeof(net->batch));
+    net->active_index = NULL;
+    net->active_value = NULL;
+    net->optimizer_state = NULL;
+    net->optimizer_update = NULL;
     
     // Allocation des couches
     net->layers = malloc(net->num_layers * sizeof(Layer*));
@@ -269,8 +305,8 @@ NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes,
         return NULL;
     }
     
-    // Allocation des tableaux de momentum
-    net->momentum_weights = malloc(net->num_layers * sizeof(float*));
+    net->arena = NULL;
+    net->velocity = NULL;
     net->momentum_biases = malloc(net->num_layers * sizeof(float));
     
     // Création des couches avec activations optimisées
@@ -283,29 +319,9 @@ NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes,
         if (i == net->num_layers - 1) {
             // Couche de sortie : sigmoid pour classification binaire
             activation = ACTIVATION_SIGMOID;
-        } else if (strcmp(activations[i], "relu") == 0) {
-            activation = ACTIVATION_RELU;
-        } else if (strcmp(activations[i], "tanh") == 0) {
-            activation = ACTIVATION_TANH;
-        } else if (strcmp(activations[i], "sigmoid") == 0) {
-            activation = ACTIVATION_SIGMOID;
-        } else if (strcmp(activations[i], "leaky_relu") == 0) {
-            activation = ACTIVATION_LEAKY_RELU;
-        } else if (strcmp(activations[i], "gelu") == 0) {
-            activation = ACTIVATION_GELU;
-        } else if (strcmp(activations[i], "mish") == 0) {
-            activation = ACTIVATION_MISH;
-        } else if (strcmp(activations[i], "swish") == 0) {
-            activation = ACTIVATION_SWISH;
-        } else if (strcmp(activations[i], "elu") == 0) {
-            activation = ACTIVATION_ELU;
-        } else if (strcmp(activations[i], "prelu") == 0) {
-            activation = ACTIVATION_PRELU;
-        } else if (strcmp(activations[i], "neuroplast") == 0) {
-            activation = ACTIVATION_NEUROPLAST; // Sera traité dans default du switch
         } else {
-            // Par défaut : ReLU pour activations non reconnues
-            activation = ACTIVATION_RELU;
+            // Conversion nom -> type (ReLU par défaut pour les activations non reconnues)
+            activation = get_activation_type(activations[i]);
         }
         
         net->layers[i] = layer_create(input_size, output_size, activation);
@@ -320,7 +336,7 @@ NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes,
         }
         
         // Initialisation des poids selon l'activation
-        init_weights_simple(net->layers[i], activation);
+        init_weights_simple(net->layers[i], activation, &net->rng);
         
         // 🔧 CORRECTION MAJEURE: Initialisation équilibrée pour la couche de sortie
         if (i == net->num_layers - 1) {
@@ -333,24 +349,25 @@ NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes,
             size_t output_size = net->layers[i]->output_size;
             float xavier_std = sqrtf(1.0f / input_size); // 🔧 CORRECTION: Réduire std pour éviter saturation
             
-            // 🔧 CORRECTION: Accès correct aux poids weights[output_idx][input_idx]
-            for (size_t out_idx = 0; out_idx < output_size; out_idx++) {
-                for (size_t in_idx = 0; in_idx < input_size; in_idx++) {
-                    // 🔧 CORRECTION: Initialisation plus conservative pour éviter saturation
-                    net->layers[i]->weights[out_idx][in_idx] = ((float)rand() / RAND_MAX - 0.5f) * xavier_std;
-                }
+            // 🔧 CORRECTION: Initialisation plus conservative pour éviter saturation
+            float *w = net->layers[i]->weight_data;
+            rng_uniform_array(&net->rng, w, output_size * input_size);
+            for (size_t k = 0; k < output_size * input_size; k++) {
+                w[k] = (w[k] - 0.5f) * xavier_std;
             }
             
             printf("🔧 Couche de sortie: biais=-1.0, poids Xavier conservateur (std=%.4f)\\n", xavier_std);
         }
         
-        // Allocation momentum pour cette couche
-        net->momentum_weights[i] = calloc(output_size * input_size, sizeof(float));
-        
         printf("Couche %zu: %zu → %zu (%s)\n", 
                i, input_size, output_size, activations[i]);
     }
     
+    // Regrouper tous les paramètres dans l'arène ; le momentum suit la même disposition
+    net->arena = param_arena_adopt_layers(net->layers, net->num_layers);
+    net->velocity = mem_aligned_calloc(PARAM_ARENA_ALIGN_FLOATS * sizeof(float), net->arena->size, sizeof(float));
+    sparse_scratch_alloc(net, n_layers, layer_sizes);
+    
     printf("Réseau simple créé avec succès (%zu couches)\n", net->num_layers);
     printf("✅ Class weights: [%.1f, %.1f] (sain, malade)\n", net->class_weights[0], net->class_weights[1]);
     printf("✅ Learning rate: %.4f | Dropout: %.0f%% | L2: %.4f\n", 
@@ -388,6 +405,12 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
     net->l2_lambda = config.l2_lambda;
     net->optimal_threshold = config.optimal_threshold;
     net->use_dropout = config.use_dropout;
+    rng_seed(&net->rng, config.seed ? config.seed : rng_seed_from_rand());
+    memset(&net->batch, 0, sizeof(net->batch));
+    net->active_index = NULL;
+    net->active_value = NULL;
+    net->optimizer_state = NULL;
+    net->optimizer_update = NULL;
     
     // Allocation des couches
     net->layers = malloc(net->num_layers * sizeof(Layer*));
@@ -396,13 +419,15 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
         return NULL;
     }
     
-    // Allocation des tableaux de momentum
-    net->momentum_weights = malloc(net->num_layers * sizeof(float*));
+    net->arena = NULL;
+    net->velocity = NULL;
     net->momentum_biases = malloc(net->num_layers * sizeof(float));
     
-    // Allocation du masque de dropout pour la couche cachée
+    // Allocation des masques de dropout : un par couche cachée, bout à bout
     if (n_layers > 2) {
-        net->dropout_mask = malloc(layer_sizes[1] * sizeof(float)); // Couche cachée
+        size_t hidden_units = 0;
+        for (size_t i = 1; i < n_layers - 1; i++) hidden_units += layer_sizes[i];
+        net->dropout_mask = malloc(hidden_units * sizeof(float));
     } else {
         net->dropout_mask = NULL;
     }
@@ -417,29 +442,9 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
         if (i == net->num_layers - 1) {
             // Couche de sortie : sigmoid pour classification binaire
             activation = ACTIVATION_SIGMOID;
-        } else if (strcmp(activations[i], "relu") == 0) {
-            activation = ACTIVATION_RELU;
-        } else if (strcmp(activations[i], "tanh") == 0) {
-            activation = ACTIVATION_TANH;
-        } else if (strcmp(activations[i], "sigmoid") == 0) {
-            activation = ACTIVATION_SIGMOID;
-        } else if (strcmp(activations[i], "leaky_relu") == 0) {
-            activation = ACTIVATION_LEAKY_RELU;
-        } else if (strcmp(activations[i], "gelu") == 0) {
-            activation = ACTIVATION_GELU;
-        } else if (strcmp(activations[i], "mish") == 0) {
-            activation = ACTIVATION_MISH;
-        } else if (strcmp(activations[i], "swish") == 0) {
-            activation = ACTIVATION_SWISH;
-        } else if (strcmp(activations[i], "elu") == 0) {
-            activation = ACTIVATION_ELU;
-        } else if (strcmp(activations[i], "prelu") == 0) {
-            activation = ACTIVATION_PRELU;
-        } else if (strcmp(activations[i], "neuroplast") == 0) {
-            activation = ACTIVATION_NEUROPLAST; // Sera traité dans default du switch
         } else {
-            // Par défaut : ReLU pour activations non reconnues
-            activation = ACTIVATION_RELU;
+            // Conversion nom -> type (ReLU par défaut pour les activations non reconnues)
+            activation = get_activation_type(activations[i]);
         }
         
         net->layers[i] = layer_create(input_size, output_size, activation);
@@ -454,7 +459,7 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
         }
         
         // Initialisation des poids selon l'activation
-        init_weights_simple(net->layers[i], activation);
+        init_weights_simple(net->layers[i], activation, &net->rng);
         
         // 🔧 CORRECTION MAJEURE: Initialisation équilibrée pour la couche de sortie
         if (i == net->num_layers - 1) {
@@ -467,24 +472,25 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
             size_t output_size = net->layers[i]->output_size;
             float xavier_std = sqrtf(1.0f / input_size); // 🔧 CORRECTION: Réduire std pour éviter saturation
             
-            // 🔧 CORRECTION: Accès correct aux poids weights[output_idx][input_idx]
-            for (size_t out_idx = 0; out_idx < output_size; out_idx++) {
-                for (size_t in_idx = 0; in_idx < input_size; in_idx++) {
-                    // 🔧 CORRECTION: Initialisation plus conservative pour éviter saturation
-                    net->layers[i]->weights[out_idx][in_idx] = ((float)rand() / RAND_MAX - 0.5f) * xavier_std;
-                }
+            // 🔧 CORRECTION: Initialisation plus conservative pour éviter saturation
+            float *w = net->layers[i]->weight_data;
+            rng_uniform_array(&net->rng, w, output_size * input_size);
+            for (size_t k = 0; k < output_size * input_size; k++) {
+                w[k] = (w[k] - 0.5f) * xavier_std;
             }
             
             printf("🔧 Couche de sortie: biais=-1.0, poids Xavier conservateur (std=%.4f)\\n", xavier_std);
         }
         
-        // Allocation momentum pour cette couche
-        net->momentum_weights[i] = calloc(output_size * input_size, sizeof(float));
-        
         printf("Couche %zu: %zu → %zu (%s)\n", 
                i, input_size, output_size, activations[i]);
     }
     
+    // Regrouper tous les paramètres dans l'arène ; le momentum suit la même disposition
+    net->arena = param_arena_adopt_layers(net->layers, net->num_layers);
+    net->velocity = mem_aligned_calloc(PARAM_ARENA_ALIGN_FLOATS * sizeof(float), net->arena->size, sizeof(float));
+    sparse_scratch_alloc(net, n_layers, layer_sizes);
+    
     printf("Réseau configuré créé avec succès (%zu couches)\n", net->num_layers);
     printf("✅ Class weights: [%.1f, %.1f] | LR: %.4f | Momentum: %.2f\n", 
            net->class_weights[0], net->class_weights[1], net->learning_rate, net->momentum);
@@ -494,6 +500,13 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
     return (NeuralNetwork*)net;
 }
 
+// Masque de dropout de la couche cachée l dans le bloc commun
+static float *dropout_mask_of(SimpleNeuralNetwork *simple_net, size_t l) {
+    float *mask = simple_net->dropout_mask;
+    for (size_t k = 0; k < l; k++) mask += simple_net->layers[k]->output_size;
+    return mask;
+}
+
 void network_forward_simple(NeuralNetwork *net, float *input) {
     SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
     
@@ -502,28 +515,24 @@ void network_forward_simple(NeuralNetwork *net, float *input) {
     for (size_t i = 0; i < simple_net->num_layers; i++) {
         Layer *layer = simple_net->layers[i];
         
-        // Calcul direct : z = W*x + b, puis activation
-        for (size_t j = 0; j < layer->output_size; j++) {
-            float z = layer->biases[j];
-            
-            for (size_t k = 0; k < layer->input_size; k++) {
-                z += layer->weights[j][k] * current_input[k];
-            }
-            
-            // Application de l'activation
-            layer->outputs[j] = apply_activation(z, layer->activation_type);
+        // Calcul direct : z = W*x + b, puis activation sur toute la couche
+        layer_affine(layer, current_input, layer->outputs, simple_net->active_index, simple_net->active_value);
+        if (layer->derivatives) {
+            // Garder f'(z) exacte pour la rétropropagation (pas de second calcul transcendant)
+            layer->kernels->forward_derivative(layer->outputs, layer->outputs, layer->derivatives,
+                                               layer->output_size);
+        } else {
+            layer->kernels->forward(layer->outputs, layer->outputs, layer->output_size);
         }
         
         // Appliquer dropout si activé (sauf pour la couche de sortie)
         if (simple_net->use_dropout && simple_net->dropout_mask && (size_t)i < simple_net->num_layers - 1) {
+            // Masque de la couche (0 ou 1/(1-p)), gardé pour la rétropropagation
+            float *mask = dropout_mask_of(simple_net, i);
+            rng_bernoulli_mask(&simple_net->rng, mask, layer->output_size, simple_net->dropout_rate,
+                               1.0f / (1.0f - simple_net->dropout_rate));
             for (size_t n = 0; n < layer->output_size; n++) {
-                // Générer masque de dropout pour cette couche
-                float dropout_prob = (float)rand() / RAND_MAX;
-                if (dropout_prob < simple_net->dropout_rate) {
-                    layer->outputs[n] = 0.0f;
-                } else {
-                    layer->outputs[n] /= (1.0f - simple_net->dropout_rate);
-                }
+                layer->outputs[n] *= mask[n];
             }
         }
         
@@ -537,35 +546,8 @@ void network_backward_simple(NeuralNetwork *net, float *input, float *target, fl
     // Calcul de l'erreur pour la couche de sortie avec équilibrage des classes OPTIMISÉ
     Layer *output_layer = simple_net->layers[simple_net->num_layers - 1];
     for (size_t i = 0; i < output_layer->output_size; i++) {
-        // Calculer l'erreur pour cette sortie
-        float target_val = target[i];
-        float output = output_layer->outputs[i];
-        float error = target_val - output;
-        
-        // ÉQUILIBRAGE DES CLASSES ADAPTATIF
-        int target_class = (target_val > 0.5f) ? 1 : 0;
-        float base_class_weight = simple_net->class_weights[target_class];
-        
-        // Pondération adaptative : plus de poids pour les erreurs importantes
-        float adaptive_weight = base_class_weight;
-        
-        // Ajustement selon la difficulté de la prédiction
-        if (target_val > 0.5f && output < 0.3f) {
-            adaptive_weight *= 1.8f; // Cas très difficile : vrai positif mal prédit
-        } else if (target_val < 0.5f && output > 0.7f) {
-            adaptive_weight *= 1.5f; // Cas difficile : faux positif
-        } else if (fabsf(target_val - output) > 0.7f) {
-            adaptive_weight *= 1.3f; // Erreur importante
-        }
-        
-        // Delta = erreur pondérée * dérivée de l'activation avec stabilisation
-        float derivative = activation_derivative(output, output_layer->activation_type);
-        // Stabilisation pour éviter les gradients évanescents dans sigmoid
-        if (output_layer->activation_type == ACTIVATION_SIGMOID) {
-            derivative = fmaxf(derivative, 0.01f); // Minimum 1% de gradient
-        }
-        
-        output_layer->deltas[i] = error * adaptive_weight * derivative;
+        output_layer->deltas[i] = output_delta_simple(simple_net, output_layer->outputs[i], target[i],
+                                                      output_layer->activation_type);
     }
     
     // Rétropropagation pour les couches cachées
@@ -573,23 +555,40 @@ void network_backward_simple(NeuralNetwork *net, float *input, float *target, fl
         Layer *current_layer = simple_net->layers[l];
         Layer *next_layer = simple_net->layers[l + 1];
         
-        for (size_t i = 0; i < current_layer->output_size; i++) {
-            float error = 0.0f;
-            
-            // Somme pondérée des erreurs de la couche suivante
-            for (size_t j = 0; j < next_layer->output_size; j++) {
-                error += next_layer->deltas[j] * next_layer->weights[j][i];
+        // Erreur rétropropagée W^T * delta, accumulée ligne par ligne (AXPY) :
+        // la matrice de la couche suivante est lue dans son ordre de stockage.
+        // Chaque error[i] reçoit les mêmes termes dans le même ordre (j croissant)
+        // que la somme par colonne, donc le résultat est identique au bit près tant que
+        // le compilateur ne fusionne pas a*b+c en FMA (-ffp-contract=off, test_network_simple).
+        float *error = current_layer->deltas;
+        size_t hidden_size = current_layer->output_size;
+        memset(error, 0, hidden_size * sizeof(float));
+        // Les unités ReLU inactives de la couche suivante ont un delta nul :
+        // leur ligne n'apporte rien et n'est pas lue.
+        for (size_t j = 0; j < next_layer->output_size; j++) {
+            const float delta_j = next_layer->deltas[j];
+            if (delta_j == 0.0f) continue;
+            const float *row = next_layer->weights[j];
+            for (size_t i = 0; i < hidden_size; i++) {
+                error[i] += delta_j * row[i];
             }
-            
-            // Prise en compte du dropout dans la rétropropagation
-            if (simple_net->use_dropout && simple_net->dropout_mask && (size_t)l < simple_net->num_layers - 1) {
-                error *= simple_net->dropout_mask[i];
+        }
+        
+        // Prise en compte du dropout dans la rétropropagation
+        if (simple_net->use_dropout && simple_net->dropout_mask && (size_t)l < simple_net->num_layers - 1) {
+            const float *mask = dropout_mask_of(simple_net, (size_t)l);
+            for (size_t i = 0; i < hidden_size; i++) {
+                error[i] *= mask[i];
             }
-            
-            // Delta = erreur * dérivée
-            float derivative = activation_derivative(current_layer->outputs[i], 
-                                                   current_layer->activation_type);
-            current_layer->deltas[i] = error * derivative;
+        }
+        
+        // Delta = erreur * dérivée (gardée par la passe avant ou déduite de la sortie)
+        if (current_layer->derivatives) {
+            for (size_t i = 0; i < current_layer->output_size; i++)
+                current_layer->deltas[i] *= current_layer->derivatives[i];
+        } else {
+            current_layer->kernels->backward(current_layer->outputs, current_layer->deltas,
+                                             current_layer->output_size);
         }
     }
     
@@ -603,16 +602,17 @@ void network_backward_simple(NeuralNetwork *net, float *input, float *target, fl
     for (size_t l = 0; l < simple_net->num_layers; l++) {
         Layer *layer = simple_net->layers[l];
         
-        // Calcul de la norme des gradients pour cette couche
-        float gradient_norm = 0.0f;
+        // Norme des gradients de la couche, sans parcourir la matrice : par échantillon
+        // le gradient des poids est de rang 1 (delta * x^T), donc
+        // ||G||² = ||delta||² * ||x||² + ||delta||² (biais compris)
+        float delta_sq = 0.0f, input_sq = 0.0f;
         for (size_t i = 0; i < layer->output_size; i++) {
-            for (size_t j = 0; j < layer->input_size; j++) {
-                float grad = layer->deltas[i] * layer_input[j];
-                gradient_norm += grad * grad;
-            }
-            gradient_norm += layer->deltas[i] * layer->deltas[i]; // Biais aussi
+            delta_sq += layer->deltas[i] * layer->deltas[i];
         }
-        gradient_norm = sqrtf(gradient_norm);
+        for (size_t j = 0; j < layer->input_size; j++) {
+            input_sq += layer_input[j] * layer_input[j];
+        }
+        float gradient_norm = sqrtf(delta_sq * (input_sq + 1.0f));
         
         // Facteur de clipping si nécessaire (plus conservateur)
         float clip_factor = 1.0f;
@@ -620,55 +620,328 @@ void network_backward_simple(NeuralNetwork *net, float *input, float *target, fl
             clip_factor = max_gradient_norm / gradient_norm;
         }
         
+        // Optimiseur externe : écrire le gradient de la perte dans l'arène (mise à jour plus bas)
+        if (simple_net->optimizer_update) {
+            for (size_t i = 0; i < layer->output_size; i++) {
+                float *grad_row = layer->grad_weights + i * layer->input_size;
+                float scaled_delta = layer->deltas[i] * clip_factor;
+                for (size_t j = 0; j < layer->input_size; j++) {
+                    grad_row[j] = -scaled_delta * layer_input[j] + simple_net->l2_lambda * layer->weights[i][j];
+                }
+                layer->grad_biases[i] = -scaled_delta;
+            }
+            layer_input = layer->outputs;
+            continue;
+        }
+        
         // Learning rate standard (pas d'adaptation par couche automatique)
         float layer_lr = effective_lr;
         
+        // Un seul passage sur la matrice : clipping, L2 et momentum appliqués ensemble
+        const float l2 = simple_net->l2_lambda;
+        const float momentum = simple_net->momentum;
+        // Sans momentum ni L2, une ligne à delta nul (unité ReLU inactive) ne change pas
+        const int gradient_only = !simple_net->use_momentum && l2 == 0.0f;
         for (size_t i = 0; i < layer->output_size; i++) {
-            // Mise à jour des poids
-            for (size_t j = 0; j < layer->input_size; j++) {
-                float gradient = layer->deltas[i] * layer_input[j] * clip_factor;
-                
-                // RÉGULARISATION L2 modérée : ajout du terme de pénalité
-                float l2_penalty = simple_net->l2_lambda * layer->weights[i][j];
-                gradient += l2_penalty;
-                
-                if (simple_net->use_momentum) {
-                    // SGD avec momentum optimisé
-                    size_t idx = i * layer->input_size + j;
-                    simple_net->momentum_weights[l][idx] = 
-                        simple_net->momentum * simple_net->momentum_weights[l][idx] + 
-                        layer_lr * gradient;
-                    layer->weights[i][j] += simple_net->momentum_weights[l][idx];
-                } else {
-                    // SGD simple avec L2
-                    layer->weights[i][j] += layer_lr * gradient;
+            const float scaled_delta = layer->deltas[i] * clip_factor;
+            if (gradient_only && scaled_delta == 0.0f) continue;
+            float *w = layer->weights[i];
+            
+            if (simple_net->use_momentum) {
+                // SGD avec momentum optimisé
+                float *velocity = simple_net->velocity + layer->weight_offset + i * layer->input_size;
+                for (size_t j = 0; j < layer->input_size; j++) {
+                    // RÉGULARISATION L2 modérée : ajout du terme de pénalité
+                    float gradient = scaled_delta * layer_input[j] + l2 * w[j];
+                    velocity[j] = momentum * velocity[j] + layer_lr * gradient;
+                    w[j] += velocity[j];
+                }
+            } else {
+                // SGD simple avec L2
+                for (size_t j = 0; j < layer->input_size; j++) {
+                    float gradient = scaled_delta * layer_input[j] + l2 * w[j];
+                    w[j] += layer_lr * gradient;
                 }
             }
             
             // Mise à jour des biais avec clipping
-            float bias_gradient = layer->deltas[i] * clip_factor;
-            layer->biases[i] += layer_lr * bias_gradient;
+            layer->biases[i] += layer_lr * scaled_delta;
         }
         
         layer_input = layer->outputs;
     }
+    
+    // Un seul pas de l'optimiseur sur tous les paramètres du réseau, en place
+    if (simple_net->optimizer_update) {
+        simple_net->optimizer_update(simple_net->optimizer_state, simple_net->arena->params,
+                                     simple_net->arena->grads);
+    }
+}
+
+// ============================================================================
+// MODE MINI-BATCH : un lot de B échantillons traité par produits matriciels
+// ============================================================================
+
+// Libérer l'espace de travail du mode mini-batch
+static void batch_workspace_free(SimpleNeuralNetwork *simple_net) {
+    BatchWorkspace *ws = &simple_net->batch;
+    if (ws->activations) {
+        for (size_t l = 0; l < simple_net->num_layers; l++) {
+            free(ws->activations[l]);
+            free(ws->deltas[l]);
+            free(ws->dropout_scale[l]);
+            free(ws->derivatives[l]);
+        }
+    }
+    free(ws->inputs);
+    free(ws->activations);
+    free(ws->deltas);
+    free(ws->dropout_scale);
+    free(ws->derivatives);
+    memset(ws, 0, sizeof(*ws));
+}
+
+// Allouer (ou agrandir) l'espace de travail pour des lots de taille batch_size
+static int batch_workspace_reserve(SimpleNeuralNetwork *simple_net, size_t batch_size) {
+    BatchWorkspace *ws = &simple_net->batch;
+    if (ws->capacity >= batch_size) return 1;
+    
+    batch_workspace_free(simple_net);
+    
+    size_t n = simple_net->num_layers;
+    ws->inputs = malloc(batch_size * simple_net->layers[0]->input_size * sizeof(float));
+    ws->activations = calloc(n, sizeof(float *));
+    ws->deltas = calloc(n, sizeof(float *));
+    ws->dropout_scale = calloc(n, sizeof(float *));
+    ws->derivatives = calloc(n, sizeof(float *));
+    if (!ws->inputs || !ws->activations || !ws->deltas || !ws->dropout_scale || !ws->derivatives) {
+        batch_workspace_free(simple_net);
+        return 0;
+    }
+    
+    for (size_t l = 0; l < n; l++) {
+        Layer *layer = simple_net->layers[l];
+        ws->activations[l] = malloc(batch_size * layer->output_size * sizeof(float));
+        ws->deltas[l] = malloc(batch_size * layer->output_size * sizeof(float));
+        ws->dropout_scale[l] = malloc(batch_size * layer->output_size * sizeof(float));
+        if (layer->derivatives)
+            ws->derivatives[l] = malloc(batch_size * layer->output_size * sizeof(float));
+        if (!ws->activations[l] || !ws->deltas[l] || !ws->dropout_scale[l] ||
+            (layer->derivatives && !ws->derivatives[l])) {
+            batch_workspace_free(simple_net);
+            return 0;
+        }
+    }
+    
+    ws->capacity = batch_size;
+    return 1;
+}
+
+// Propagation avant du lot : A_l = f(A_{l-1} * W_l^T + b_l)
+static void network_forward_batch_simple(SimpleNeuralNetwork *simple_net, size_t batch_size) {
+    BatchWorkspace *ws = &simple_net->batch;
+    const float *current = ws->inputs;
+    
+    for (size_t l = 0; l < simple_net->num_layers; l++) {
+        Layer *layer = simple_net->layers[l];
+        size_t in = layer->input_size, out = layer->output_size;
+        float *act = ws->activations[l];
+        
+        // Z = X * W^T : W est stocké out x in, sa transposée a les pas (1, in)
+        gemm(batch_size, out, in,
+             1.0f,
+             current, (ptrdiff_t)in, 1,
+             layer->weight_data, 1, (ptrdiff_t)in,
+             0.0f,
+             act, (ptrdiff_t)out, 1);
+        
+        for (size_t b = 0; b < batch_size; b++) {
+            float *row = act + b * out;
+            for (size_t j = 0; j < out; j++)
+                row[j] += layer->biases[j];
+        }
+        if (ws->derivatives[l])
+            layer->kernels->forward_derivative(act, act, ws->derivatives[l], batch_size * out);
+        else
+            layer->kernels->forward(act, act, batch_size * out);
+        
+        // Dropout sur les couches cachées (même condition que le mode par échantillon)
+        if (simple_net->use_dropout && simple_net->dropout_mask && l < simple_net->num_layers - 1) {
+            float keep_scale = 1.0f / (1.0f - simple_net->dropout_rate);
+            float *scale = ws->dropout_scale[l];
+            rng_bernoulli_mask(&simple_net->rng, scale, batch_size * out, simple_net->dropout_rate, keep_scale);
+            for (size_t k = 0; k < batch_size * out; k++)
+                act[k] *= scale[k];
+        }
+        
+        current = act;
+    }
+}
+
+// Entraînement sur un lot : propagation avant, rétropropagation et gradients par
+// produits matriciels, puis une seule mise à jour des paramètres avec le gradient moyen.
+// Retourne la somme des erreurs quadratiques du lot (sorties avant mise à jour).
+float network_train_batch_simple(NeuralNetwork *net, float **inputs, float **targets,
+                                 size_t batch_size, float learning_rate) {
+    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
+    if (!simple_net || batch_size == 0) return 0.0f;
+    if (!batch_workspace_reserve(simple_net, batch_size)) {
+        fprintf(stderr, "Erreur: allocation de l'espace de travail mini-batch (%zu)\n", batch_size);
+        return 0.0f;
+    }
+    
+    BatchWorkspace *ws = &simple_net->batch;
+    size_t n = simple_net->num_layers;
+    size_t input_size = simple_net->layers[0]->input_size;
+    
+    // Copier le lot dans un tampon contigu B x input_size
+    for (size_t b = 0; b < batch_size; b++)
+        memcpy(ws->inputs + b * input_size, inputs[b], input_size * sizeof(float));
+    
+    network_forward_batch_simple(simple_net, batch_size);
+    
+    // Deltas de la couche de sortie et perte quadratique
+    Layer *output_layer = simple_net->layers[n - 1];
+    size_t out_size = output_layer->output_size;
+    float batch_loss = 0.0f;
+    for (size_t b = 0; b < batch_size; b++) {
+        const float *out_row = ws->activations[n - 1] + b * out_size;
+        float *delta_row = ws->deltas[n - 1] + b * out_size;
+        for (size_t i = 0; i < out_size; i++) {
+            delta_row[i] = output_delta_simple(simple_net, out_row[i], targets[b][i],
+                                               output_layer->activation_type);
+        }
+        float error = out_row[0] - targets[b][0];
+        batch_loss += error * error;
+    }
+    
+    // Rétropropagation : D_l = (D_{l+1} * W_{l+1}) ⊙ f'(A_l)
+    for (int l = (int)n - 2; l >= 0; l--) {
+        Layer *current_layer = simple_net->layers[l];
+        Layer *next_layer = simple_net->layers[l + 1];
+        size_t out = current_layer->output_size;
+        
+        gemm(batch_size, out, next_layer->output_size,
+             1.0f,
+             ws->deltas[l + 1], (ptrdiff_t)next_layer->output_size, 1,
+             next_layer->weight_data, (ptrdiff_t)next_layer->input_size, 1,
+             0.0f,
+             ws->deltas[l], (ptrdiff_t)out, 1);
+        
+        int dropped = simple_net->use_dropout && simple_net->dropout_mask;
+        float *delta = ws->deltas[l];
+        const float *act = ws->activations[l];
+        if (dropped) {
+            for (size_t k = 0; k < batch_size * out; k++)
+                delta[k] *= ws->dropout_scale[l][k];
+        }
+        if (ws->derivatives[l]) {
+            const float *deriv = ws->derivatives[l];
+            for (size_t k = 0; k < batch_size * out; k++)
+                delta[k] *= deriv[k];
+        } else {
+            current_layer->kernels->backward(act, delta, batch_size * out);
+        }
+    }
+    
+    // Gradients moyens du lot : G_l = D_l^T * A_{l-1} / B, g_b = somme des lignes de D_l / B
+    float inv_batch = 1.0f / (float)batch_size;
+    float effective_lr = learning_rate > 0 ? learning_rate : simple_net->learning_rate;
+    float max_gradient_norm = 10.0f; // Même seuil de clipping que le mode par échantillon
+    const float *layer_input = ws->inputs;
+    
+    for (size_t l = 0; l < n; l++) {
+        Layer *layer = simple_net->layers[l];
+        size_t in = layer->input_size, out = layer->output_size;
+        float *grad_w = layer->grad_weights;
+        float *grad_b = layer->grad_biases;
+        const float *delta = ws->deltas[l];
+        
+        gemm(out, in, batch_size,
+             inv_batch,
+             delta, 1, (ptrdiff_t)out,
+             layer_input, (ptrdiff_t)in, 1,
+             0.0f,
+             grad_w, (ptrdiff_t)in, 1);
+        
+        memset(grad_b, 0, out * sizeof(float));
+        for (size_t b = 0; b < batch_size; b++)
+            for (size_t i = 0; i < out; i++)
+                grad_b[i] += delta[b * out + i];
+        
+        float gradient_norm = 0.0f;
+        for (size_t i = 0; i < out; i++) {
+            grad_b[i] *= inv_batch;
+            gradient_norm += grad_b[i] * grad_b[i];
+        }
+        for (size_t k = 0; k < out * in; k++)
+            gradient_norm += grad_w[k] * grad_w[k];
+        gradient_norm = sqrtf(gradient_norm);
+        
+        float clip_factor = 1.0f;
+        if (gradient_norm > max_gradient_norm) {
+            clip_factor = max_gradient_norm / gradient_norm;
+        }
+        
+        // Optimiseur externe : convertir en gradient de la perte (descente), mise à jour plus bas
+        if (simple_net->optimizer_update) {
+            const float *w = layer->weight_data;
+            for (size_t k = 0; k < out * in; k++)
+                grad_w[k] = -grad_w[k] * clip_factor + simple_net->l2_lambda * w[k];
+            for (size_t i = 0; i < out; i++)
+                grad_b[i] = -grad_b[i] * clip_factor;
+            layer_input = ws->activations[l];
+            continue;
+        }
+        
+        // Mise à jour : même règle que le mode par échantillon (momentum + L2),
+        // en un passage linéaire sur la tranche de poids de la couche dans l'arène
+        float *w = layer->weight_data;
+        float *velocity = simple_net->velocity + layer->weight_offset;
+        for (size_t k = 0; k < out * in; k++) {
+            float gradient = grad_w[k] * clip_factor + simple_net->l2_lambda * w[k];
+            if (simple_net->use_momentum) {
+                velocity[k] = simple_net->momentum * velocity[k] + effective_lr * gradient;
+                w[k] += velocity[k];
+            } else {
+                w[k] += effective_lr * gradient;
+            }
+        }
+        for (size_t i = 0; i < out; i++)
+            layer->biases[i] += effective_lr * grad_b[i] * clip_factor;
+        
+        layer_input = ws->activations[l];
+    }
+    
+    if (simple_net->optimizer_update) {
+        simple_net->optimizer_update(simple_net->optimizer_state, simple_net->arena->params,
+                                     simple_net->arena->grads);
+    }
+    
+    // Conserver la sortie du dernier échantillon pour network_output_simple
+    memcpy(output_layer->outputs, ws->activations[n - 1] + (batch_size - 1) * out_size,
+           out_size * sizeof(float));
+    
+    return batch_loss;
 }
 
 void network_free_simple(NeuralNetwork *net) {
     SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
     if (!simple_net) return;
     
+    batch_workspace_free(simple_net);
+    
     if (simple_net->layers) {
         for (size_t i = 0; i < simple_net->num_layers; i++) {
             layer_free(simple_net->layers[i]);
-            if (simple_net->momentum_weights && simple_net->momentum_weights[i]) {
-                free(simple_net->momentum_weights[i]);
-            }
         }
         free(simple_net->layers);
     }
     
-    if (simple_net->momentum_weights) free(simple_net->momentum_weights);
+    param_arena_free(simple_net->arena);
+    mem_aligned_free(simple_net->velocity);
+    free(simple_net->active_index);
+    free(simple_net->active_value);
     if (simple_net->momentum_biases) free(simple_net->momentum_biases);
     if (simple_net->dropout_mask) free(simple_net->dropout_mask);
     free(simple_net);
@@ -680,98 +953,270 @@ float *network_output_simple(NeuralNetwork *net) {
     return simple_net->layers[simple_net->num_layers - 1]->outputs;
 }
 
-// Fonction pour activer/désactiver le dropout (entraînement vs évaluation)
-void network_set_dropout_simple(NeuralNetwork *net, int use_dropout) {
-    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
-    simple_net->use_dropout = use_dropout;
-}
+// ============================================================================
+// INFÉRENCE : modèle en lecture seule, tampons propres à chaque contexte
+// ============================================================================
 
-// Fonction pour optimiser le seuil de décision basé sur F1-score (CORRIGÉE)
-float optimize_threshold_simple(NeuralNetwork *net, float inputs[][21], float targets[], int num_samples) {
-    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
-    
-    // Désactiver dropout pour évaluation
-    int original_dropout = simple_net->use_dropout;
-    simple_net->use_dropout = 0;
+struct InferenceContext {
+    float *buffers[2];        // Activations des couches cachées (alternées)
+    uint32_t *active_index;   // Noyau creux : indices des entrées non nulles
+    float *active_value;
+};
+
+InferenceContext *inference_context_create(const NeuralNetwork *net) {
+    const SimpleNeuralNetwork *simple_net = (const SimpleNeuralNetwork*)net;
+    if (!simple_net || !simple_net->layers || simple_net->num_layers == 0) return NULL;
     
-    float best_threshold = 0.5f;
-    float best_score = 0.0f;
+    size_t widest = simple_net->layers[0]->input_size;
+    for (size_t l = 0; l < simple_net->num_layers; l++) {
+        if (simple_net->layers[l]->output_size > widest) widest = simple_net->layers[l]->output_size;
+    }
     
-    // Debug désactivé par défaut, peut être activé en changeant if(0) en if(1)
-    if(0) printf("🔍 Debug: Analyse des prédictions avant optimisation...\n");
+    InferenceContext *ctx = calloc(1, sizeof(InferenceContext));
+    if (!ctx) return NULL;
+    ctx->buffers[0] = malloc(widest * sizeof(float));
+    ctx->buffers[1] = malloc(widest * sizeof(float));
+    ctx->active_index = malloc(widest * sizeof(uint32_t));
+    ctx->active_value = malloc(widest * sizeof(float));
+    if (!ctx->buffers[0] || !ctx->buffers[1] || !ctx->active_index || !ctx->active_value) {
+        inference_context_free(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+void inference_context_free(InferenceContext *ctx) {
+    if (!ctx) return;
+    free(ctx->buffers[0]);
+    free(ctx->buffers[1]);
+    free(ctx->active_index);
+    free(ctx->active_value);
+    free(ctx);
+}
+
+// Même calcul que network_forward_simple sans dropout ni cache de dérivées :
+// seuls les poids et biais sont lus, toutes les écritures vont dans ctx et output
+void network_predict_simple(const NeuralNetwork *net, InferenceContext *ctx, const float *input, float *output) {
+    const SimpleNeuralNetwork *simple_net = (const SimpleNeuralNetwork*)net;
+    const float *current_input = input;
     
-    // Analyser les prédictions actuelles
-    float min_score = 1.0f, max_score = 0.0f;
-    int actual_positives = 0;
-    for (int i = 0; i < num_samples; i++) {
-        network_forward_simple(net, inputs[i]);
-        float *output = network_output_simple(net);
+    for (size_t l = 0; l < simple_net->num_layers; l++) {
+        const Layer *layer = simple_net->layers[l];
+        float *z = (l == simple_net->num_layers - 1) ? output : ctx->buffers[l & 1];
         
-        if (output) {
-            float score = output[0];
-            if (score < min_score) min_score = score;
-            if (score > max_score) max_score = score;
-            
-            if (targets[i] > 0.5f) actual_positives++;
+        layer_affine(layer, current_input, z, ctx->active_index, ctx->active_value);
+        layer->kernels->forward(z, z, layer->output_size);
+        
+        current_input = z;
+    }
+}
+
+float network_dead_fraction_simple(const NeuralNetwork *net, InferenceContext *ctx,
+                                   float **inputs, size_t num_samples) {
+    const SimpleNeuralNetwork *simple_net = (const SimpleNeuralNetwork*)net;
+    if (simple_net->num_layers < 2 || num_samples == 0) return 0.0f;
+    
+    // Une marque par unité cachée : 1 dès qu'une sortie non nulle est observée
+    size_t hidden_units = 0;
+    for (size_t l = 0; l + 1 < simple_net->num_layers; l++) hidden_units += simple_net->layers[l]->output_size;
+    unsigned char *alive = calloc(hidden_units, 1);
+    if (!alive) return 0.0f;
+    
+    for (size_t i = 0; i < num_samples; i++) {
+        const float *current_input = inputs[i];
+        size_t offset = 0;
+        for (size_t l = 0; l + 1 < simple_net->num_layers; l++) {
+            const Layer *layer = simple_net->layers[l];
+            float *z = ctx->buffers[l & 1];
+            layer_affine(layer, current_input, z, ctx->active_index, ctx->active_value);
+            layer->kernels->forward(z, z, layer->output_size);
+            for (size_t n = 0; n < layer->output_size; n++) alive[offset + n] |= (z[n] != 0.0f);
+            offset += layer->output_size;
+            current_input = z;
         }
     }
     
-    printf("📊 Scores: min=%.4f, max=%.4f | Positifs réels: %d/%d\n", 
-           min_score, max_score, actual_positives, num_samples);
+    float worst = 0.0f;
+    size_t offset = 0;
+    for (size_t l = 0; l + 1 < simple_net->num_layers; l++) {
+        size_t units = simple_net->layers[l]->output_size, dead = 0;
+        for (size_t n = 0; n < units; n++) dead += !alive[offset + n];
+        if ((float)dead / units > worst) worst = (float)dead / units;
+        offset += units;
+    }
+    free(alive);
+    return worst;
+}
+
+// ============================================================================
+// PRÉDICTION PAR LOTS : GEMM par tranche de lignes, tranches sur le pool de threads
+// ============================================================================
+
+// Taille de tranche : deux tampons d'activations de la couche la plus large
+// doivent tenir dans ~256 Ko (cache L2), entre 16 et 256 lignes
+#define PREDICT_CACHE_BYTES (256 * 1024)
+#define PREDICT_MIN_ROWS 16
+#define PREDICT_MAX_ROWS 256
+
+typedef struct {
+    const SimpleNeuralNetwork *net;
+    const Dataset *dataset;
+    float *scores;
+    size_t widest;        // Plus grande largeur de couche (entrée comprise)
+    int failed;           // Une tranche n'a pas pu allouer son espace de travail
+} PredictBatchJob;
+
+// Espace de travail propre à chaque thread, agrandi à la demande et libéré à
+// la sortie du thread (comme gemm)
+static __thread float *predict_buf = NULL;
+static __thread size_t predict_cap = 0;
+
+static void predict_buf_release(void *slot) {
+    (void)slot;
+    mem_aligned_free(predict_buf);
+    predict_buf = NULL;
+    predict_cap = 0;
+}
+
+static void predict_batch_slice(void *ctx, size_t begin, size_t end) {
+    PredictBatchJob *job = (PredictBatchJob*)ctx;
+    const SimpleNeuralNetwork *simple_net = job->net;
+    size_t rows = end - begin;
     
-    // 🔧 CORRECTION: Utiliser F1-Score standard au lieu d'un score composite complexe
-    // Tester différents seuils avec recherche adaptative
-    for (float threshold = 0.01f; threshold <= 0.99f; threshold += 0.01f) {
-        int TP = 0, FP = 0, FN = 0, TN = 0;
-        
-        // Calculer métriques pour ce seuil
-        for (int i = 0; i < num_samples; i++) {
-            network_forward_simple(net, inputs[i]);
-            float *output = network_output_simple(net);
-            
-            if (output) {
-                int predicted = (output[0] > threshold) ? 1 : 0;
-                int actual = (targets[i] > 0.5f) ? 1 : 0;
-                
-                if (predicted == 1 && actual == 1) TP++;
-                else if (predicted == 1 && actual == 0) FP++;
-                else if (predicted == 0 && actual == 1) FN++;
-                else TN++;
-            }
+    size_t needed = 2 * rows * job->widest;
+    if (needed > predict_cap) {
+        if (!predict_buf) mem_thread_at_exit(predict_buf_release, &predict_buf);
+        mem_aligned_free(predict_buf);
+        predict_buf = mem_aligned_alloc(64, needed * sizeof(float));
+        predict_cap = predict_buf ? needed : 0;
+        if (!predict_buf) {
+            job->failed = 1;
+            return;
         }
+    }
+    float *buffers[2] = { predict_buf, predict_buf + rows * job->widest };
+    
+    // Lignes de la tranche regroupées en une matrice rows x input_size
+    size_t in = simple_net->layers[0]->input_size;
+    for (size_t r = 0; r < rows; r++)
+        memcpy(buffers[0] + r * in, job->dataset->inputs[begin + r], in * sizeof(float));
+    
+    const float *current = buffers[0];
+    for (size_t l = 0; l < simple_net->num_layers; l++) {
+        const Layer *layer = simple_net->layers[l];
+        size_t out = layer->output_size;
+        int last = (l == simple_net->num_layers - 1);
+        float *act = last ? job->scores + begin * out : buffers[(l + 1) & 1];
         
-        // Calculer métriques complètes
-        float precision = (TP + FP > 0) ? (float)TP / (TP + FP) : 0.0f;
-        float recall = (TP + FN > 0) ? (float)TP / (TP + FN) : 0.0f;
-        float f1 = (precision + recall > 0) ? 2.0f * precision * recall / (precision + recall) : 0.0f;
-        
-        // 🔧 CORRECTION: Utiliser F1-Score standard comme métrique d'optimisation
-        float current_score = f1;
-        
-        // Debug pour les seuils intéressants
-        if (threshold <= 0.15f || f1 > 0.1f || current_score > 0.0f) {
-            printf("  Seuil %.2f: TP=%d FP=%d FN=%d TN=%d | Prec=%.3f Recall=%.3f F1=%.3f\n",
-                   threshold, TP, FP, FN, TN, precision, recall, f1);
+        // A_l = f(A_{l-1} * W_l^T + b_l), comme network_forward_batch_simple sans dropout
+        gemm(rows, out, layer->input_size,
+             1.0f,
+             current, (ptrdiff_t)layer->input_size, 1,
+             layer->weight_data, 1, (ptrdiff_t)layer->input_size,
+             0.0f,
+             act, (ptrdiff_t)out, 1);
+        for (size_t r = 0; r < rows; r++) {
+            float *row = act + r * out;
+            for (size_t j = 0; j < out; j++)
+                row[j] += layer->biases[j];
         }
+        layer->kernels->forward(act, act, rows * out);
         
-        // Mettre à jour le meilleur selon le F1-Score
-        if (current_score > best_score) {
-            best_score = current_score;
-            best_threshold = threshold;
-        }
+        current = act;
+    }
+}
+
+int network_predict_batch(const NeuralNetwork *net, const Dataset *dataset, float *scores_out) {
+    const SimpleNeuralNetwork *simple_net = (const SimpleNeuralNetwork*)net;
+    if (!simple_net || !dataset || !scores_out || simple_net->num_layers == 0) return 0;
+    if (dataset->input_cols != simple_net->layers[0]->input_size) {
+        printf("Erreur: le dataset a %zu colonnes, le réseau attend %zu entrées\n",
+               dataset->input_cols, simple_net->layers[0]->input_size);
+        return 0;
+    }
+    if (dataset->num_samples == 0) return 1;
+    
+    PredictBatchJob job = { simple_net, dataset, scores_out, simple_net->layers[0]->input_size, 0 };
+    for (size_t l = 0; l < simple_net->num_layers; l++) {
+        if (simple_net->layers[l]->output_size > job.widest) job.widest = simple_net->layers[l]->output_size;
+    }
+    
+    size_t rows = PREDICT_CACHE_BYTES / (2 * job.widest * sizeof(float));
+    if (rows < PREDICT_MIN_ROWS) rows = PREDICT_MIN_ROWS;
+    if (rows > PREDICT_MAX_ROWS) rows = PREDICT_MAX_ROWS;
+    
+    gemm_init();  // Choix du noyau avant que les threads n'appellent gemm
+    parallel_for(dataset->num_samples, rows, predict_batch_slice, &job);
+    return !job.failed;
+}
+
+// Fonction pour activer/désactiver le dropout (entraînement vs évaluation)
+void network_set_dropout_simple(NeuralNetwork *net, int use_dropout) {
+    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
+    simple_net->use_dropout = use_dropout;
+}
+
+// Brancher un optimiseur externe : chaque pas appelle update(state, params, grads) une fois
+// sur toute l'arène (taille net->arena->size), sans copie. update == NULL rétablit le SGD intégré.
+void network_attach_optimizer_simple(NeuralNetwork *net, void *state, ParamUpdateFn update) {
+    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
+    if (!simple_net) return;
+    simple_net->optimizer_state = state;
+    simple_net->optimizer_update = update;
+    if (simple_net->arena) param_arena_zero_grads(simple_net->arena);
+}
+
+// Réensemencer les tirages du réseau (dropout) : un essai = une graine
+void network_seed_simple(NeuralNetwork *net, uint64_t seed) {
+    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
+    if (simple_net) rng_seed(&simple_net->rng, seed);
+}
+
+// Seuil de décision maximisant le F1 : une passe avant par lots sur le dataset,
+// puis un seul tri et un balayage exact de tous les seuils candidats
+float optimize_threshold_simple(NeuralNetwork *net, const Dataset *dataset) {
+    SimpleNeuralNetwork *simple_net = (SimpleNeuralNetwork*)net;
+    if (!simple_net || !dataset || dataset->num_samples == 0) return 0.5f;
+    
+    size_t num_samples = dataset->num_samples;
+    size_t output_size = net->layers[net->num_layers - 1]->output_size;
+    MetricsWorkspace workspace;
+    metrics_workspace_init(&workspace);
+    
+    if (!metrics_workspace_reserve(&workspace, num_samples * output_size) ||
+        !network_predict_batch(net, dataset, workspace.scores)) {
+        printf("Erreur: allocation mémoire ou prédiction pour l'optimisation du seuil\n");
+        metrics_workspace_free(&workspace);
+        return simple_net->optimal_threshold;
+    }
+    
+    for (size_t i = 0; i < num_samples; i++) {
+        workspace.scores[i] = workspace.scores[i * output_size];
+        workspace.labels[i] = dataset->outputs[i][0];
     }
     
+    MetricsSummary summary;
+    metrics_sweep(&workspace, num_samples, simple_net->optimal_threshold, NULL, NULL, &summary);
+    metrics_workspace_free(&workspace);
+    
+    printf("📊 Scores: min=%.4f, max=%.4f | Positifs réels: %zu/%zu\n", 
+           summary.min_score, summary.max_score, summary.positives, num_samples);
+    
+    const ThresholdMetrics *best = &summary.best_f1;
+    float best_threshold = best->threshold;
+    
     // 🔧 CORRECTION: Si aucun seuil optimal trouvé, utiliser 0.5 par défaut
-    if (best_score == 0.0f) {
+    if (best->f1 == 0.0f) {
         best_threshold = 0.5f;
         printf("⚠️ Aucun seuil optimal trouvé, utilisation de 0.5 par défaut\n");
+    } else {
+        printf("  TP=%zu FP=%zu FN=%zu TN=%zu | Prec=%.3f Recall=%.3f\n",
+               best->tp, best->fp, best->fn, best->tn, best->precision, best->recall);
     }
     
-    // Restaurer état dropout
-    simple_net->use_dropout = original_dropout;
     simple_net->optimal_threshold = best_threshold;
     
-    printf("🎯 Seuil optimal trouvé: %.2f (F1: %.3f)\n", best_threshold, best_score);
+    printf("🎯 Seuil optimal trouvé: %.4f (F1: %.3f)\n", best_threshold, best->f1);
     return best_threshold;
 }
 
@@ -1,7 +1,9 @@
 #ifndef NETWORK_SIMPLE_H
 #define NETWORK_SIMPLE_H
 
+#include <stdint.h>
 #include "network.h"
+#include "../data/dataset.h"
 
 // Structure pour paramètres configurables
 typedef struct {
@@ -13,6 +15,7 @@ typedef struct {
     float class_weight_ratio;  // ratio classe minoritaire / majoritaire
     int use_momentum;
     int use_dropout;
+    uint64_t seed;             // Graine des tirages du réseau (0 = dérivée de srand())
 } NetworkConfig;
 
 // Fonction pour créer une configuration par défaut
@@ -24,6 +27,11 @@ NetworkConfig create_config_for_optimizer(const char *optimizer_name);
 // Fonctions simplifiées et robustes
 NeuralNetwork *network_create_simple(size_t n_layers, const size_t *layer_sizes, const char **activations);
 
+// Même réseau, tirages (poids, dropout) issus de seed : un essai est reproductible
+// quel que soit le thread qui l'exécute (0 = graine dérivée de srand())
+NeuralNetwork *network_create_simple_seeded(size_t n_layers, const size_t *layer_sizes,
+                                            const char **activations, uint64_t seed);
+
 // Nouvelle fonction avec configuration personnalisée
 NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *layer_sizes, 
                                                 const char **activations, NetworkConfig config);
@@ -31,11 +39,45 @@ NeuralNetwork *network_create_simple_configured(size_t n_layers, const size_t *l
 void network_forward_simple(NeuralNetwork *net, float *input);
 void network_backward_simple(NeuralNetwork *net, float *input, float *target, float learning_rate);
 void network_free_simple(NeuralNetwork *net);
+
+// Entraînement mini-batch : une mise à jour par lot (gradient moyen), produits matriciels.
+// inputs/targets : batch_size pointeurs de lignes. Retourne la somme des erreurs quadratiques.
+float network_train_batch_simple(NeuralNetwork *net, float **inputs, float **targets,
+                                 size_t batch_size, float learning_rate);
 float *network_output_simple(NeuralNetwork *net);
 
+// Inférence sans état partagé : le réseau n'est que lu, chaque thread utilise son
+// propre contexte (tampons d'activations alloués une fois). Plusieurs threads
+// peuvent prédire en même temps avec le même réseau tant qu'il n'est pas entraîné.
+typedef struct InferenceContext InferenceContext;
+InferenceContext *inference_context_create(const NeuralNetwork *net);
+void inference_context_free(InferenceContext *ctx);
+
+// output : sorties de la dernière couche. Aucune allocation, dropout jamais appliqué.
+void network_predict_simple(const NeuralNetwork *net, InferenceContext *ctx, const float *input, float *output);
+
+// Plus forte proportion d'unités mortes (sortie nulle pour chacune des num_samples
+// entrées, typiquement des ReLU bloquées) parmi les couches cachées, dans [0, 1]
+float network_dead_fraction_simple(const NeuralNetwork *net, InferenceContext *ctx,
+                                   float **inputs, size_t num_samples);
+
+// Scores de tout un dataset : tranches de lignes adaptées au cache calculées par
+// GEMM et réparties sur le pool de threads. scores_out : num_samples x taille de
+// sortie (ordre ligne). Le réseau n'est que lu. Retourne 0 en cas d'erreur.
+int network_predict_batch(const NeuralNetwork *net, const Dataset *dataset, float *scores_out);
+
+// Optimiseur externe sur l'arène de paramètres (même signature que OptimizerUpdateFn) :
+// params/grads couvrent net->arena->size floats, grads contient le gradient de la perte.
+typedef void (*ParamUpdateFn)(void *state, float *params, float *grads);
+void network_attach_optimizer_simple(NeuralNetwork *net, void *state, ParamUpdateFn update);
+
+// Réensemencer le générateur du réseau (dropout) pour rendre un essai reproductible
+void network_seed_simple(NeuralNetwork *net, uint64_t seed);
+
 // Nouvelles fonctions pour équilibrage et anti-overfitting
 void network_set_dropout_simple(NeuralNetwork *net, int use_dropout);
-float optimize_threshold_simple(NeuralNetwork *net, float inputs[][21], float targets[], int num_samples);
+// Seuil maximisant le F1 sur le dataset (balayage exact de tous les seuils candidats)
+float optimize_threshold_simple(NeuralNetwork *net, const Dataset *dataset);
 int predict_with_optimal_threshold_simple(NeuralNetwork *net, float *input);
 
 #endif 
\ No newline at end of file
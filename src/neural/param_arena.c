@@ -0,0 +1,94 @@
+#include "param_arena.h"
+#include "../memory.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Arrondir au multiple d'alignement supérieur
+static size_t arena_pad(size_t count) {
+    return (count + PARAM_ARENA_ALIGN_FLOATS - 1) / PARAM_ARENA_ALIGN_FLOATS * PARAM_ARENA_ALIGN_FLOATS;
+}
+
+ParamArena *param_arena_adopt_layers(Layer **layers, size_t num_layers) {
+    if (!layers) return NULL;
+
+    // Disposition : pour chaque couche, poids puis biais, chaque tranche alignée
+    size_t total = 0;
+    for (size_t l = 0; l < num_layers; l++) {
+        if (!layers[l]) continue;
+        total += arena_pad(layers[l]->output_size * layers[l]->input_size);
+        total += arena_pad(layers[l]->output_size);
+    }
+
+    ParamArena *arena = mem_alloc(sizeof(ParamArena));
+    arena->size = total;
+    arena->params = mem_aligned_calloc(PARAM_ARENA_ALIGN_FLOATS * sizeof(float), total, sizeof(float));
+    arena->grads = mem_aligned_calloc(PARAM_ARENA_ALIGN_FLOATS * sizeof(float), total, sizeof(float));
+
+    size_t offset = 0;
+    for (size_t l = 0; l < num_layers; l++) {
+        Layer *layer = layers[l];
+        if (!layer) continue;
+        size_t in = layer->input_size, out = layer->output_size;
+
+        layer->weight_offset = offset;
+        offset += arena_pad(out * in);
+        layer->bias_offset = offset;
+        offset += arena_pad(out);
+
+        float *weights = arena->params + layer->weight_offset;
+        float *biases = arena->params + layer->bias_offset;
+        memcpy(weights, layer->weight_data, out * in * sizeof(float));
+        memcpy(biases, layer->biases, out * sizeof(float));
+
+        if (!layer->params_in_arena) {
+            free(layer->weight_data);
+            free(layer->biases);
+        }
+
+        layer->weight_data = weights;
+        layer->biases = biases;
+        for (size_t i = 0; i < out; i++)
+            layer->weights[i] = weights + i * in;
+        layer->grad_weights = arena->grads + layer->weight_offset;
+        layer->grad_biases = arena->grads + layer->bias_offset;
+        layer->params_in_arena = 1;
+    }
+
+    return arena;
+}
+
+void param_arena_free(ParamArena *arena) {
+    if (!arena) return;
+    mem_aligned_free(arena->params);
+    mem_aligned_free(arena->grads);
+    mem_free(arena);
+}
+
+// Remise à zéro de tous les gradients (un seul memset)
+void param_arena_zero_grads(ParamArena *arena) {
+    if (!arena) return;
+    memset(arena->grads, 0, arena->size * sizeof(float));
+}
+
+// Norme L2 de tous les gradients du réseau (le rembourrage reste à zéro)
+float param_arena_grad_norm(const ParamArena *arena) {
+    if (!arena) return 0.0f;
+    float sum = 0.0f;
+    for (size_t k = 0; k < arena->size; k++)
+        sum += arena->grads[k] * arena->grads[k];
+    return sqrtf(sum);
+}
+
+void param_arena_scale_grads(ParamArena *arena, float factor) {
+    if (!arena) return;
+    for (size_t k = 0; k < arena->size; k++)
+        arena->grads[k] *= factor;
+}
+
+// Copier les paramètres d'une arène de même disposition (un seul memcpy)
+int param_arena_copy_params(ParamArena *dest, const ParamArena *src) {
+    if (!dest || !src || dest->size != src->size) return -1;
+    memcpy(dest->params, src->params, src->size * sizeof(float));
+    return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef PARAM_ARENA_H
+#define PARAM_ARENA_H
+
+#include <stddef.h>
+#include "layer.h"
+
+// Alignement des blocs et des tranches de couche (en floats : 16 = 64 octets)
+#define PARAM_ARENA_ALIGN_FLOATS 16
+
+// Arène de paramètres : tous les poids et biais d'un réseau dans un seul bloc aligné,
+// avec un bloc de gradients de même disposition. Chaque couche occupe deux tranches
+// (poids out x in, puis biais) repérées par weight_offset et bias_offset.
+typedef struct ParamArena {
+    float *params;   // Bloc des paramètres (poids et biais de toutes les couches)
+    float *grads;    // Bloc des gradients (même disposition que params)
+    size_t size;     // Nombre de floats de chaque bloc (rembourrage compris)
+} ParamArena;
+
+// Déplacer les paramètres des couches dans une nouvelle arène : les valeurs sont
+// conservées, les pointeurs weights/weight_data/biases des couches sont redirigés
+// et leurs tampons privés libérés. Les couches NULL sont ignorées.
+ParamArena *param_arena_adopt_layers(Layer **layers, size_t num_layers);
+void param_arena_free(ParamArena *arena);
+
+// Opérations linéaires sur tout le bloc
+void param_arena_zero_grads(ParamArena *arena);
+float param_arena_grad_norm(const ParamArena *arena);
+void param_arena_scale_grads(ParamArena *arena, float factor);
+int param_arena_copy_params(ParamArena *dest, const ParamArena *src);
+
+#endif /* PARAM_ARENA_H */
@@ -1,4 +1,5 @@
 #include "adabelief.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -7,22 +8,24 @@ AdaBeliefState *adabelief_init(size_t size, float lr, float beta1, float beta2,
     state->m = calloc(size, sizeof(float));
     state->s = calloc(size, sizeof(float));
     state->beta1 = beta1; state->beta2 = beta2; state->epsilon = epsilon; state->lr = lr; state->size = size; state->t = 0;
+    state->beta1_power = 1.0f; state->beta2_power = 1.0f;
     return state;
 }
 
 void adabelief_update(AdaBeliefState *state, float *w, float *grad) {
     state->t++;
-    float b1 = state->beta1, b2 = state->beta2, lr = state->lr, eps = state->epsilon;
-    float b1t = powf(b1, state->t), b2t = powf(b2, state->t);
-    for (size_t i = 0; i < state->size; i++) {
-        float g = grad[i];
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * g;
-        float diff = g - state->m[i];
-        state->s[i] = b2 * state->s[i] + (1.0f - b2) * diff * diff;
-        float m_hat = state->m[i] / (1.0f - b1t);
-        float s_hat = state->s[i] / (1.0f - b2t);
-        w[i] -= lr * m_hat / (sqrtf(s_hat) + eps);
-    }
+    state->beta1_power *= state->beta1;
+    state->beta2_power *= state->beta2;
+
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_ADABELIEF,
+        .beta1 = state->beta1, .beta2 = state->beta2,
+        .grad_scale = 1.0f,
+        .m_step = state->lr / (1.0f - state->beta1_power),
+        .v_scale = 1.0f / sqrtf(1.0f - state->beta2_power),
+        .epsilon = state->epsilon
+    };
+    fused_adam_step(&step, w, grad, state->m, state->s, state->size);
 }
 
 void adabelief_free(AdaBeliefState *state) {
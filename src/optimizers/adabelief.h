@@ -7,6 +7,7 @@ typedef struct {
     float beta1, beta2, epsilon, lr;
     size_t size;
     int t;
+    float beta1_power, beta2_power; // beta1^t et beta2^t (produits courants, sans powf)
 } AdaBeliefState;
 
 AdaBeliefState *adabelief_init(size_t size, float lr, float beta1, float beta2, float epsilon);
@@ -1,4 +1,5 @@
 #include "adam.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -22,12 +23,15 @@ AdamState *adam_init(size_t size, float lr, float beta1, float beta2, float epsi
     state->lr = lr;
     state->size = size;
     state->t = 0;
+    state->beta1_power = 1.0f;
+    state->beta2_power = 1.0f;
     
     // Nouveaux paramètres pour l'amélioration
     state->initial_lr = lr;
     state->warmup_steps = 1000;
     state->decay_factor = 0.9999f;
     state->grad_clip_norm = 5.0f;
+    state->decay_power = 1.0f;
     
     return state;
 }
@@ -37,12 +41,8 @@ void adam_update(AdamState *state, float *w, float *grad) {
     
     state->t++;
     
-    // Calcul de la norme du gradient pour clipping
-    float grad_norm = 0.0f;
-    for (size_t i = 0; i < state->size; i++) {
-        grad_norm += grad[i] * grad[i];
-    }
-    grad_norm = sqrtf(grad_norm);
+    // Calcul de la norme du gradient pour clipping (passage en lecture seule)
+    float grad_norm = sqrtf(fused_sum_squares(grad, state->size));
     
     // Gradient clipping adaptatif
     float clip_factor = 1.0f;
@@ -57,61 +57,46 @@ void adam_update(AdamState *state, float *w, float *grad) {
     if (state->t <= state->warmup_steps) {
         adaptive_lr = state->initial_lr * (float)state->t / state->warmup_steps;
     } else {
-        // Décroissance exponentielle après warmup
-        adaptive_lr = state->initial_lr * powf(state->decay_factor, state->t - state->warmup_steps);
+        // Décroissance exponentielle après warmup (decay_factor^(t - warmup) en produit courant)
+        state->decay_power *= state->decay_factor;
+        adaptive_lr = state->initial_lr * state->decay_power;
     }
     
     // Limites pour éviter des taux d'apprentissage trop extrêmes
     adaptive_lr = fmaxf(adaptive_lr, state->initial_lr * 0.01f); // Au moins 1% du taux initial
     adaptive_lr = fminf(adaptive_lr, state->initial_lr * 2.0f);  // Au plus 200% du taux initial
     
-    float b1 = state->beta1, b2 = state->beta2, eps = state->epsilon;
+    float b2 = state->beta2;
     
     // Correction de biais améliorée (rectifiée)
-    float b1t = powf(b1, state->t);
-    float b2t = powf(b2, state->t);
+    state->beta1_power *= state->beta1;
+    state->beta2_power *= b2;
+    float b1t = state->beta1_power;
+    float b2t = state->beta2_power;
     
     // RAdam correction - Variance corrigée
     float rho_inf = 2.0f / (1.0f - b2) - 1.0f;
     float rho_t = rho_inf - 2.0f * state->t * b2t / (1.0f - b2t);
     
-    for (size_t i = 0; i < state->size; i++) {
-        // Application du gradient clipping
-        float clipped_grad = grad[i] * clip_factor;
-        
-        // Mise à jour des moments avec amélioration numérique
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * clipped_grad;
-        state->v[i] = b2 * state->v[i] + (1.0f - b2) * clipped_grad * clipped_grad;
-        
-        // Correction de biais
-        float m_hat = state->m[i] / (1.0f - b1t);
-        
-        float update;
-        
-        if (rho_t > 4.0f) {
-            // RAdam update avec variance corrigée
-            float v_hat = state->v[i] / (1.0f - b2t);
-            float rect = sqrtf((rho_t - 4.0f) * (rho_t - 2.0f) * rho_inf / 
-                              ((rho_inf - 4.0f) * (rho_inf - 2.0f) * rho_t));
-            update = adaptive_lr * rect * m_hat / (sqrtf(v_hat) + eps);
-        } else {
-            // SGD avec momentum quand la variance n'est pas bien définie
-            update = adaptive_lr * m_hat;
-        }
-        
-        // Application de la mise à jour avec vérification de stabilité
-        float weight_update = update;
-        
-        // Anti-explosion des poids
-        if (fabsf(weight_update) > 1.0f) {
-            weight_update = copysignf(1.0f, weight_update);
-        }
-        
-        w[i] -= weight_update;
-        
-        // Contrainte pour éviter les poids extrêmes
-        w[i] = fmaxf(-10.0f, fminf(10.0f, w[i]));
+    // Tous les scalaires du pas sont calculés ici ; la boucle par élément est fusionnée
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_MOMENTUM,      // SGD avec momentum quand la variance n'est pas bien définie
+        .beta1 = state->beta1, .beta2 = b2,
+        .grad_scale = clip_factor,
+        .m_step = adaptive_lr / (1.0f - b1t),
+        .v_scale = 1.0f / sqrtf(1.0f - b2t),
+        .epsilon = state->epsilon,
+        .max_update = 1.0f,               // Anti-explosion des poids
+        .max_weight = 10.0f               // Contrainte pour éviter les poids extrêmes
+    };
+    if (rho_t > 4.0f) {
+        // RAdam update avec variance corrigée
+        float rect = sqrtf((rho_t - 4.0f) * (rho_t - 2.0f) * rho_inf / 
+                          ((rho_inf - 4.0f) * (rho_inf - 2.0f) * rho_t));
+        step.rule = FUSED_RULE_ADAM;
+        step.m_step *= rect;
     }
+    fused_adam_step(&step, w, grad, state->m, state->v, state->size);
     
     // Mise à jour adaptative des hyperparamètres basée sur la performance
     if (state->t % 100 == 0) {
@@ -121,6 +106,10 @@ void adam_update(AdamState *state, float *w, float *grad) {
         } else if (grad_norm < 0.1f) {
             state->beta2 = fmaxf(0.9f, state->beta2 - 0.001f); // Diminuer pour plus de réactivité
         }
+        // beta2 a changé : recalculer beta2^t une seule fois
+        if (state->beta2 != b2) {
+            state->beta2_power = powf(state->beta2, state->t);
+        }
     }
 }
 
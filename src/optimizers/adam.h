@@ -8,12 +8,14 @@ typedef struct {
     float beta1, beta2, epsilon, lr;
     size_t size;
     int t;
+    float beta1_power, beta2_power; // beta1^t et beta2^t (produits courants, sans powf)
     
     // Nouveaux champs pour les améliorations
     float initial_lr;        // Taux d'apprentissage initial
     int warmup_steps;        // Étapes de warmup
     float decay_factor;      // Facteur de décroissance
     float grad_clip_norm;    // Norme pour gradient clipping
+    float decay_power;       // decay_factor^(t - warmup_steps) après le warmup
 } AdamState;
 
 AdamState *adam_init(size_t size, float lr, float beta1, float beta2, float epsilon);
@@ -1,4 +1,5 @@
 #include "adamax.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -7,19 +8,22 @@ AdamaxState *adamax_init(size_t size, float lr, float beta1, float beta2, float
     state->m = calloc(size, sizeof(float));
     state->u = calloc(size, sizeof(float));
     state->beta1 = beta1; state->beta2 = beta2; state->lr = lr; state->epsilon = epsilon; state->size = size; state->t = 0;
+    state->beta1_power = 1.0f;
     return state;
 }
 
 void adamax_update(AdamaxState *state, float *w, float *grad) {
     state->t++;
-    float b1 = state->beta1, lr = state->lr, eps = state->epsilon;
-    float b1t = powf(b1, state->t);
+    state->beta1_power *= state->beta1;
 
-    for (size_t i = 0; i < state->size; i++) {
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * grad[i];
-        state->u[i] = fmaxf(state->beta2 * state->u[i], fabsf(grad[i]));
-        w[i] -= (lr / (1.0f - b1t)) * (state->m[i] / (state->u[i] + eps));
-    }
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_ADAMAX,
+        .beta1 = state->beta1, .beta2 = state->beta2,
+        .grad_scale = 1.0f,
+        .m_step = state->lr / (1.0f - state->beta1_power),
+        .epsilon = state->epsilon
+    };
+    fused_adam_step(&step, w, grad, state->m, state->u, state->size);
 }
 
 void adamax_free(AdamaxState *state) {
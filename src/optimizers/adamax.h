@@ -7,6 +7,7 @@ typedef struct {
     float beta1, beta2, lr, epsilon;
     size_t size;
     int t;
+    float beta1_power;              // beta1^t (produit courant, sans powf)
 } AdamaxState;
 
 AdamaxState *adamax_init(size_t size, float lr, float beta1, float beta2, float epsilon);
@@ -1,4 +1,5 @@
 #include "adamw.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -8,20 +9,25 @@ AdamWState *adamw_init(size_t size, float lr, float beta1, float beta2, float ep
     state->v = calloc(size, sizeof(float));
     state->beta1 = beta1; state->beta2 = beta2; state->epsilon = epsilon;
     state->lr = lr; state->weight_decay = weight_decay; state->size = size; state->t = 0;
+    state->beta1_power = 1.0f; state->beta2_power = 1.0f;
     return state;
 }
 
 void adamw_update(AdamWState *state, float *w, float *grad) {
     state->t++;
-    float b1 = state->beta1, b2 = state->beta2, lr = state->lr, eps = state->epsilon, wd = state->weight_decay;
-    float b1t = powf(b1, state->t), b2t = powf(b2, state->t);
-    for (size_t i = 0; i < state->size; i++) {
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * grad[i];
-        state->v[i] = b2 * state->v[i] + (1.0f - b2) * grad[i] * grad[i];
-        float m_hat = state->m[i] / (1.0f - b1t);
-        float v_hat = state->v[i] / (1.0f - b2t);
-        w[i] -= lr * (m_hat / (sqrtf(v_hat) + eps) + wd * w[i]);
-    }
+    state->beta1_power *= state->beta1;
+    state->beta2_power *= state->beta2;
+
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_ADAM,
+        .beta1 = state->beta1, .beta2 = state->beta2,
+        .grad_scale = 1.0f,
+        .m_step = state->lr / (1.0f - state->beta1_power),
+        .v_scale = 1.0f / sqrtf(1.0f - state->beta2_power),
+        .epsilon = state->epsilon,
+        .decay = state->lr * state->weight_decay   // Décroissance découplée
+    };
+    fused_adam_step(&step, w, grad, state->m, state->v, state->size);
 }
 
 void adamw_free(AdamWState *state) {
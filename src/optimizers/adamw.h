@@ -7,6 +7,7 @@ typedef struct {
     float beta1, beta2, epsilon, lr, weight_decay;
     size_t size;
     int t;
+    float beta1_power, beta2_power; // beta1^t et beta2^t (produits courants, sans powf)
 } AdamWState;
 
 AdamWState *adamw_init(size_t size, float lr, float beta1, float beta2, float epsilon, float weight_decay);
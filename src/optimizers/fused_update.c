@@ -0,0 +1,338 @@
+#include "fused_update.h"
+#include "../thread_pool.h"
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FUSED_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+// Au-delà de ce nombre de paramètres, le pas est réparti entre les threads
+#define FUSED_PARALLEL_MIN (1 << 16)
+// Taille d'une tranche (multiple de 16 : vecteurs AVX-512 complets)
+#define FUSED_GRAIN (1 << 14)
+// Nombre maximal de sommes partielles pour la réduction parallèle
+#define FUSED_MAX_PARTIALS 256
+
+typedef void (*FusedKernel)(const FusedAdamStep *step, float *w, const float *grad,
+                            float *m, float *v, size_t begin, size_t end);
+typedef float (*SumSquaresKernel)(const float *grad, size_t begin, size_t end);
+
+// ============================================================================
+// VERSION PORTABLE
+// ============================================================================
+
+static inline __attribute__((always_inline))
+void fused_scalar_body(const FusedAdamStep *s, FusedRule rule, float *w, const float *grad,
+                       float *m, float *v, size_t begin, size_t end) {
+    const float b1 = s->beta1, b2 = s->beta2;
+    const float one_minus_b1 = 1.0f - b1, one_minus_b2 = 1.0f - b2;
+    const float keep = 1.0f - s->decay;
+
+    for (size_t i = begin; i < end; i++) {
+        float g = grad[i] * s->grad_scale;
+        float mi = b1 * m[i] + one_minus_b1 * g;
+        float vi;
+        switch (rule) {
+            case FUSED_RULE_ADABELIEF: { float d = g - mi; vi = b2 * v[i] + one_minus_b2 * d * d; break; }
+            case FUSED_RULE_ADAMAX:    vi = fmaxf(b2 * v[i], fabsf(g)); break;
+            default:                   vi = b2 * v[i] + one_minus_b2 * g * g; break;
+        }
+        m[i] = mi;
+        v[i] = vi;
+
+        float u = s->m_step * mi + s->g_step * g;
+        if (rule == FUSED_RULE_ADAMAX)
+            u /= vi + s->epsilon;
+        else if (rule != FUSED_RULE_MOMENTUM)
+            u /= sqrtf(vi) * s->v_scale + s->epsilon;
+
+        if (s->max_update > 0.0f) u = fminf(fmaxf(u, -s->max_update), s->max_update);
+        float wi = w[i] * keep - u;
+        if (s->max_weight > 0.0f) wi = fminf(fmaxf(wi, -s->max_weight), s->max_weight);
+        w[i] = wi;
+    }
+}
+
+static void fused_scalar(const FusedAdamStep *s, float *w, const float *grad,
+                         float *m, float *v, size_t begin, size_t end) {
+    switch (s->rule) {
+        case FUSED_RULE_ADAM:      fused_scalar_body(s, FUSED_RULE_ADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_NADAM:     fused_scalar_body(s, FUSED_RULE_NADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADABELIEF: fused_scalar_body(s, FUSED_RULE_ADABELIEF, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADAMAX:    fused_scalar_body(s, FUSED_RULE_ADAMAX, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_MOMENTUM:  fused_scalar_body(s, FUSED_RULE_MOMENTUM, w, grad, m, v, begin, end); break;
+    }
+}
+
+static float sum_squares_scalar(const float *grad, size_t begin, size_t end) {
+    float sum = 0.0f;
+    for (size_t i = begin; i < end; i++)
+        sum += grad[i] * grad[i];
+    return sum;
+}
+
+#ifdef FUSED_HAVE_X86
+
+// ============================================================================
+// VERSION AVX2 / FMA (8 floats par itération)
+// ============================================================================
+
+__attribute__((target("avx2,fma"), always_inline)) static inline
+void fused_avx2_body(const FusedAdamStep *s, FusedRule rule, float *w, const float *grad,
+                     float *m, float *v, size_t begin, size_t end) {
+    const __m256 gs = _mm256_set1_ps(s->grad_scale);
+    const __m256 b1 = _mm256_set1_ps(s->beta1), omb1 = _mm256_set1_ps(1.0f - s->beta1);
+    const __m256 b2 = _mm256_set1_ps(s->beta2), omb2 = _mm256_set1_ps(1.0f - s->beta2);
+    const __m256 m_step = _mm256_set1_ps(s->m_step), g_step = _mm256_set1_ps(s->g_step);
+    const __m256 v_scale = _mm256_set1_ps(s->v_scale), eps = _mm256_set1_ps(s->epsilon);
+    const __m256 keep = _mm256_set1_ps(1.0f - s->decay);
+    const __m256 max_u = _mm256_set1_ps(s->max_update), min_u = _mm256_set1_ps(-s->max_update);
+    const __m256 max_w = _mm256_set1_ps(s->max_weight), min_w = _mm256_set1_ps(-s->max_weight);
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const int clamp_u = s->max_update > 0.0f, clamp_w = s->max_weight > 0.0f;
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 g = _mm256_mul_ps(_mm256_loadu_ps(grad + i), gs);
+        __m256 mi = _mm256_fmadd_ps(b1, _mm256_loadu_ps(m + i), _mm256_mul_ps(omb1, g));
+        __m256 vi = _mm256_loadu_ps(v + i);
+        if (rule == FUSED_RULE_ADABELIEF) {
+            __m256 d = _mm256_sub_ps(g, mi);
+            vi = _mm256_fmadd_ps(b2, vi, _mm256_mul_ps(omb2, _mm256_mul_ps(d, d)));
+        } else if (rule == FUSED_RULE_ADAMAX) {
+            vi = _mm256_max_ps(_mm256_mul_ps(b2, vi), _mm256_and_ps(g, abs_mask));
+        } else {
+            vi = _mm256_fmadd_ps(b2, vi, _mm256_mul_ps(omb2, _mm256_mul_ps(g, g)));
+        }
+        _mm256_storeu_ps(m + i, mi);
+        _mm256_storeu_ps(v + i, vi);
+
+        __m256 u = _mm256_fmadd_ps(m_step, mi, _mm256_mul_ps(g_step, g));
+        if (rule == FUSED_RULE_ADAMAX)
+            u = _mm256_div_ps(u, _mm256_add_ps(vi, eps));
+        else if (rule != FUSED_RULE_MOMENTUM)
+            u = _mm256_div_ps(u, _mm256_fmadd_ps(_mm256_sqrt_ps(vi), v_scale, eps));
+
+        if (clamp_u) u = _mm256_min_ps(_mm256_max_ps(u, min_u), max_u);
+        __m256 wi = _mm256_fmsub_ps(_mm256_loadu_ps(w + i), keep, u);
+        if (clamp_w) wi = _mm256_min_ps(_mm256_max_ps(wi, min_w), max_w);
+        _mm256_storeu_ps(w + i, wi);
+    }
+    if (i < end) fused_scalar_body(s, rule, w, grad, m, v, i, end);
+}
+
+__attribute__((target("avx2,fma")))
+static void fused_avx2(const FusedAdamStep *s, float *w, const float *grad,
+                       float *m, float *v, size_t begin, size_t end) {
+    switch (s->rule) {
+        case FUSED_RULE_ADAM:      fused_avx2_body(s, FUSED_RULE_ADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_NADAM:     fused_avx2_body(s, FUSED_RULE_NADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADABELIEF: fused_avx2_body(s, FUSED_RULE_ADABELIEF, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADAMAX:    fused_avx2_body(s, FUSED_RULE_ADAMAX, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_MOMENTUM:  fused_avx2_body(s, FUSED_RULE_MOMENTUM, w, grad, m, v, begin, end); break;
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static float sum_squares_avx2(const float *grad, size_t begin, size_t end) {
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        __m256 a = _mm256_loadu_ps(grad + i);
+        __m256 b = _mm256_loadu_ps(grad + i + 8);
+        acc0 = _mm256_fmadd_ps(a, a, acc0);
+        acc1 = _mm256_fmadd_ps(b, b, acc1);
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(acc0, acc1));
+    float sum = lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    return sum + sum_squares_scalar(grad, i, end);
+}
+
+// ============================================================================
+// VERSION AVX-512 (16 floats par itération)
+// ============================================================================
+
+__attribute__((target("avx512f"), always_inline)) static inline
+void fused_avx512_body(const FusedAdamStep *s, FusedRule rule, float *w, const float *grad,
+                       float *m, float *v, size_t begin, size_t end) {
+    const __m512 gs = _mm512_set1_ps(s->grad_scale);
+    const __m512 b1 = _mm512_set1_ps(s->beta1), omb1 = _mm512_set1_ps(1.0f - s->beta1);
+    const __m512 b2 = _mm512_set1_ps(s->beta2), omb2 = _mm512_set1_ps(1.0f - s->beta2);
+    const __m512 m_step = _mm512_set1_ps(s->m_step), g_step = _mm512_set1_ps(s->g_step);
+    const __m512 v_scale = _mm512_set1_ps(s->v_scale), eps = _mm512_set1_ps(s->epsilon);
+    const __m512 keep = _mm512_set1_ps(1.0f - s->decay);
+    const __m512 max_u = _mm512_set1_ps(s->max_update), min_u = _mm512_set1_ps(-s->max_update);
+    const __m512 max_w = _mm512_set1_ps(s->max_weight), min_w = _mm512_set1_ps(-s->max_weight);
+    const int clamp_u = s->max_update > 0.0f, clamp_w = s->max_weight > 0.0f;
+
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        __m512 g = _mm512_mul_ps(_mm512_loadu_ps(grad + i), gs);
+        __m512 mi = _mm512_fmadd_ps(b1, _mm512_loadu_ps(m + i), _mm512_mul_ps(omb1, g));
+        __m512 vi = _mm512_loadu_ps(v + i);
+        if (rule == FUSED_RULE_ADABELIEF) {
+            __m512 d = _mm512_sub_ps(g, mi);
+            vi = _mm512_fmadd_ps(b2, vi, _mm512_mul_ps(omb2, _mm512_mul_ps(d, d)));
+        } else if (rule == FUSED_RULE_ADAMAX) {
+            vi = _mm512_max_ps(_mm512_mul_ps(b2, vi), _mm512_abs_ps(g));
+        } else {
+            vi = _mm512_fmadd_ps(b2, vi, _mm512_mul_ps(omb2, _mm512_mul_ps(g, g)));
+        }
+        _mm512_storeu_ps(m + i, mi);
+        _mm512_storeu_ps(v + i, vi);
+
+        __m512 u = _mm512_fmadd_ps(m_step, mi, _mm512_mul_ps(g_step, g));
+        if (rule == FUSED_RULE_ADAMAX)
+            u = _mm512_div_ps(u, _mm512_add_ps(vi, eps));
+        else if (rule != FUSED_RULE_MOMENTUM)
+            u = _mm512_div_ps(u, _mm512_fmadd_ps(_mm512_sqrt_ps(vi), v_scale, eps));
+
+        if (clamp_u) u = _mm512_min_ps(_mm512_max_ps(u, min_u), max_u);
+        __m512 wi = _mm512_fmsub_ps(_mm512_loadu_ps(w + i), keep, u);
+        if (clamp_w) wi = _mm512_min_ps(_mm512_max_ps(wi, min_w), max_w);
+        _mm512_storeu_ps(w + i, wi);
+    }
+    if (i < end) fused_scalar_body(s, rule, w, grad, m, v, i, end);
+}
+
+__attribute__((target("avx512f")))
+static void fused_avx512(const FusedAdamStep *s, float *w, const float *grad,
+                         float *m, float *v, size_t begin, size_t end) {
+    switch (s->rule) {
+        case FUSED_RULE_ADAM:      fused_avx512_body(s, FUSED_RULE_ADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_NADAM:     fused_avx512_body(s, FUSED_RULE_NADAM, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADABELIEF: fused_avx512_body(s, FUSED_RULE_ADABELIEF, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_ADAMAX:    fused_avx512_body(s, FUSED_RULE_ADAMAX, w, grad, m, v, begin, end); break;
+        case FUSED_RULE_MOMENTUM:  fused_avx512_body(s, FUSED_RULE_MOMENTUM, w, grad, m, v, begin, end); break;
+    }
+}
+
+__attribute__((target("avx512f")))
+static float sum_squares_avx512(const float *grad, size_t begin, size_t end) {
+    __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+    size_t i = begin;
+    for (; i + 32 <= end; i += 32) {
+        __m512 a = _mm512_loadu_ps(grad + i);
+        __m512 b = _mm512_loadu_ps(grad + i + 16);
+        acc0 = _mm512_fmadd_ps(a, a, acc0);
+        acc1 = _mm512_fmadd_ps(b, b, acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1)) + sum_squares_scalar(grad, i, end);
+}
+
+#endif /* FUSED_HAVE_X86 */
+
+// ============================================================================
+// SÉLECTION ET RÉPARTITION
+// ============================================================================
+
+static FusedKernel active_kernel = NULL;
+static SumSquaresKernel active_sum_squares = NULL;
+static const char *active_isa = "scalar";
+static pthread_once_t fused_once = PTHREAD_ONCE_INIT;
+
+// Installer le noyau d'un jeu d'instructions ; 0 si le CPU ne le propose pas
+static int fused_use(const char *isa) {
+    FusedKernel kernel = fused_scalar;
+    SumSquaresKernel sum_squares = sum_squares_scalar;
+    const char *name = "scalar";
+    if (strcmp(isa, "scalar") != 0) {
+#ifdef FUSED_HAVE_X86
+        __builtin_cpu_init();
+        if (strcmp(isa, "avx512") == 0 && __builtin_cpu_supports("avx512f")) {
+            kernel = fused_avx512; sum_squares = sum_squares_avx512; name = "avx512";
+        } else if (strcmp(isa, "avx2") == 0 && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            kernel = fused_avx2; sum_squares = sum_squares_avx2; name = "avx2";
+        } else {
+            return 0;
+        }
+#else
+        return 0;
+#endif
+    }
+    active_sum_squares = sum_squares;
+    active_isa = name;
+    active_kernel = kernel;
+    return 1;
+}
+
+static void fused_select(void) {
+    if (!fused_use("avx512") && !fused_use("avx2")) fused_use("scalar");
+}
+
+int fused_update_force_isa(const char *isa) {
+    pthread_once(&fused_once, fused_select);
+    if (!isa) {
+        fused_select();
+        return 1;
+    }
+    return fused_use(isa);
+}
+
+typedef struct {
+    const FusedAdamStep *step;
+    float *w;
+    const float *grad;
+    float *m;
+    float *v;
+} FusedJob;
+
+static void fused_chunk(void *ctx, size_t begin, size_t end) {
+    FusedJob *job = (FusedJob *)ctx;
+    active_kernel(job->step, job->w, job->grad, job->m, job->v, begin, end);
+}
+
+void fused_adam_step(const FusedAdamStep *step, float *w, const float *grad,
+                     float *m, float *v, size_t n) {
+    pthread_once(&fused_once, fused_select);
+    if (n < FUSED_PARALLEL_MIN) {
+        active_kernel(step, w, grad, m, v, 0, n);
+        return;
+    }
+    FusedJob job = { step, w, grad, m, v };
+    parallel_for(n, FUSED_GRAIN, fused_chunk, &job);
+}
+
+typedef struct {
+    const float *grad;
+    size_t n;
+    size_t grain;
+    float partials[FUSED_MAX_PARTIALS];
+} SumSquaresJob;
+
+static void sum_squares_chunk(void *ctx, size_t begin, size_t end) {
+    SumSquaresJob *job = (SumSquaresJob *)ctx;
+    for (size_t c = begin; c < end; c++) {
+        size_t lo = c * job->grain;
+        size_t hi = (lo + job->grain < job->n) ? lo + job->grain : job->n;
+        job->partials[c] = active_sum_squares(job->grad, lo, hi);
+    }
+}
+
+float fused_sum_squares(const float *grad, size_t n) {
+    pthread_once(&fused_once, fused_select);
+    if (n < FUSED_PARALLEL_MIN) return active_sum_squares(grad, 0, n);
+
+    // Sommes partielles par tranche, réduites dans un ordre fixe (résultat reproductible)
+    SumSquaresJob job;
+    job.grad = grad;
+    job.n = n;
+    job.grain = (n + FUSED_MAX_PARTIALS - 1) / FUSED_MAX_PARTIALS;
+    if (job.grain < FUSED_GRAIN) job.grain = FUSED_GRAIN;
+    size_t chunks = (n + job.grain - 1) / job.grain;
+    parallel_for(chunks, 1, sum_squares_chunk, &job);
+
+    float sum = 0.0f;
+    for (size_t c = 0; c < chunks; c++)
+        sum += job.partials[c];
+    return sum;
+}
+
+const char *fused_update_isa(void) {
+    pthread_once(&fused_once, fused_select);
+    return active_isa;
+}
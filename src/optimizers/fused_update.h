@@ -0,0 +1,53 @@
+#ifndef FUSED_UPDATE_H
+#define FUSED_UPDATE_H
+
+#include <stddef.h>
+
+// Règle de mise à jour de la famille Adam appliquée par le noyau fusionné
+typedef enum {
+    FUSED_RULE_ADAM,        // v = EMA(g²), pas = m / (sqrt(v) + eps)       (Adam, AdamW, RAdam rectifié)
+    FUSED_RULE_NADAM,       // pas de Nesterov : (a*m + c*g) / (sqrt(v) + eps)
+    FUSED_RULE_ADABELIEF,   // s = EMA((g - m)²) à la place de v
+    FUSED_RULE_ADAMAX,      // u = max(beta2 * u, |g|), pas = m / (u + eps)
+    FUSED_RULE_MOMENTUM     // pas = m seul (RAdam quand la variance n'est pas encore définie)
+} FusedRule;
+
+// Scalaires d'un pas, calculés une fois par l'optimiseur (aucun powf dans la boucle).
+// Pour chaque élément :
+//   g  = grad * grad_scale
+//   m  = beta1 * m + (1 - beta1) * g
+//   v  = selon la règle
+//   u  = (m_step * m + g_step * g) / (sqrt(v) * v_scale + epsilon)   (dénominateur selon la règle)
+//   u  = clamp(u, ±max_update)                  si max_update > 0
+//   w  = w - u - decay * w
+//   w  = clamp(w, ±max_weight)                  si max_weight > 0
+typedef struct {
+    FusedRule rule;
+    float beta1, beta2;
+    float grad_scale;    // Facteur de clipping du gradient (1 = aucun)
+    float m_step;        // lr * rectification / (1 - beta1^t)
+    float g_step;        // Terme en g (NAdam : lr * (1 - beta1) / (1 - beta1^t)), 0 sinon
+    float v_scale;       // 1 / sqrt(1 - beta2^t) (correction de biais du second moment)
+    float epsilon;
+    float decay;         // Décroissance découplée des poids (AdamW : lr * weight_decay)
+    float max_update;    // Borne sur |u| (0 = aucune)
+    float max_weight;    // Borne sur |w| (0 = aucune)
+} FusedAdamStep;
+
+// Un passage fusionné sur n paramètres : moments, correction de biais, décroissance,
+// bornes et écriture des poids. Vectorisé (AVX-512 / AVX2 selon le CPU, sinon portable)
+// et réparti sur le pool de threads pour les grands blocs.
+void fused_adam_step(const FusedAdamStep *step, float *w, const float *grad,
+                     float *m, float *v, size_t n);
+
+// Somme des carrés de grad (norme² pour le clipping), vectorisée et parallèle
+float fused_sum_squares(const float *grad, size_t n);
+
+// Nom du jeu d'instructions utilisé ("avx512", "avx2", "scalar")
+const char *fused_update_isa(void);
+
+// Forcer un jeu d'instructions (tests, comparaison des noyaux) ; NULL : retour à la
+// détection du CPU. Retourne 0 si le CPU ne le propose pas (noyau inchangé).
+int fused_update_force_isa(const char *isa);
+
+#endif /* FUSED_UPDATE_H */
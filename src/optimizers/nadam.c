@@ -1,4 +1,5 @@
 #include "nadam.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -13,33 +14,29 @@ NadamState *nadam_init(size_t size, float lr, float beta1, float beta2, float ep
     state->lr = lr;
     state->size = size;
     state->t = 0;
+    state->beta1_power = 1.0f;
+    state->beta2_power = 1.0f;
     return state;
 }
 
 void nadam_update(NadamState *state, float *w, float *grad) {
     state->t += 1;
     float b1 = state->beta1;
-    float b2 = state->beta2;
-    float lr = state->lr;
-    float eps = state->epsilon;
-    float b1t = powf(b1, state->t);
-    float b2t = powf(b2, state->t);
+    state->beta1_power *= b1;
+    state->beta2_power *= state->beta2;
+    float bias1 = 1.0f - state->beta1_power;
 
-    for (size_t i = 0; i < state->size; i++) {
-        // Mise à jour des moments
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * grad[i];
-        state->v[i] = b2 * state->v[i] + (1.0f - b2) * grad[i] * grad[i];
-
-        // Moments biais-corrigés
-        float m_hat = state->m[i] / (1.0f - b1t);
-        float v_hat = state->v[i] / (1.0f - b2t);
-
-        // Correction Nesterov (NAdam)
-        float m_nesterov = b1 * m_hat + (1.0f - b1) * grad[i] / (1.0f - b1t);
-
-        // Mise à jour du poids
-        w[i] -= lr * m_nesterov / (sqrtf(v_hat) + eps);
-    }
+    // Correction Nesterov (NAdam) : b1 * m_hat + (1 - b1) * g / (1 - b1^t)
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_NADAM,
+        .beta1 = b1, .beta2 = state->beta2,
+        .grad_scale = 1.0f,
+        .m_step = state->lr * b1 / bias1,
+        .g_step = state->lr * (1.0f - b1) / bias1,
+        .v_scale = 1.0f / sqrtf(1.0f - state->beta2_power),
+        .epsilon = state->epsilon
+    };
+    fused_adam_step(&step, w, grad, state->m, state->v, state->size);
 }
 
 void nadam_free(NadamState *state) {
@@ -1,4 +1,5 @@
 #include "radam.h"
+#include "fused_update.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -8,30 +9,35 @@ RAdamState *radam_init(size_t size, float lr, float beta1, float beta2, float ep
     state->v = calloc(size, sizeof(float));
     state->beta1 = beta1; state->beta2 = beta2; state->epsilon = epsilon;
     state->lr = lr; state->size = size; state->t = 0;
+    state->beta1_power = 1.0f; state->beta2_power = 1.0f;
     return state;
 }
 
 void radam_update(RAdamState *state, float *w, float *grad) {
     state->t++;
-    float b1 = state->beta1, b2 = state->beta2, lr = state->lr, eps = state->epsilon;
-    float b1t = powf(b1, state->t), b2t = powf(b2, state->t);
+    float b2 = state->beta2, lr = state->lr;
+    state->beta1_power *= state->beta1;
+    state->beta2_power *= b2;
+    float b1t = state->beta1_power, b2t = state->beta2_power;
 
     float rho_inf = 2.0f / (1.0f - b2) - 1.0f;
     float rho_t = rho_inf - 2.0f * state->t * b2t / (1.0f - b2t);
 
-    for (size_t i = 0; i < state->size; i++) {
-        state->m[i] = b1 * state->m[i] + (1.0f - b1) * grad[i];
-        state->v[i] = b2 * state->v[i] + (1.0f - b2) * grad[i] * grad[i];
-
-        float m_hat = state->m[i] / (1.0f - b1t);
-        if (rho_t > 4) {
-            float v_hat = state->v[i] / (1.0f - b2t);
-            float r = sqrtf(((rho_t - 4) * (rho_t - 2) * rho_inf) / ((rho_inf - 4) * (rho_inf - 2) * rho_t));
-            w[i] -= lr * r * m_hat / (sqrtf(v_hat) + eps);
-        } else {
-            w[i] -= lr * m_hat;
-        }
+    // Rectification calculée une fois par pas ; SGD avec momentum tant que rho_t <= 4
+    FusedAdamStep step = {
+        .rule = FUSED_RULE_MOMENTUM,
+        .beta1 = state->beta1, .beta2 = b2,
+        .grad_scale = 1.0f,
+        .m_step = lr / (1.0f - b1t),
+        .v_scale = 1.0f / sqrtf(1.0f - b2t),
+        .epsilon = state->epsilon
+    };
+    if (rho_t > 4) {
+        float r = sqrtf(((rho_t - 4) * (rho_t - 2) * rho_inf) / ((rho_inf - 4) * (rho_inf - 2) * rho_t));
+        step.rule = FUSED_RULE_ADAM;
+        step.m_step *= r;
     }
+    fused_adam_step(&step, w, grad, state->m, state->v, state->size);
 }
 
 void radam_free(RAdamState *state) {
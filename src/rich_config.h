@@ -52,6 +52,7 @@ typedef struct {
     int auto_normalize;            // 1 = normalisation automatique des champs numériques
     int auto_categorize;           // 1 = binarisation automatique des champs catégoriques
     char field_detection[32];      // "auto" = détection automatique des types
+    int dataset_cache;             // 1 = cache binaire du dataset traité à côté du CSV (voir data/dataset_cache.h)
 
     // Configuration pour le traitement d'images
     char image_train_dir[256];     // Répertoire d'entraînement (obligatoire)
@@ -75,6 +76,17 @@ typedef struct {
     int early_stopping;  // 0 = désactivé, 1 = activé
     int patience;        // nombre d'époques sans amélioration avant arrêt
     
+    // Surveillance de santé des essais (voir training/health_monitor.h)
+    int health_monitor;              // 0 = désactivée, 1 = activée
+    int health_warmup_epochs;        // Aucun verdict avant cette époque
+    int health_check_interval;       // Époques entre deux sondages des unités mortes
+    float health_saturation_range;   // Plage max-min des scores sous laquelle les sorties sont saturées
+    int health_saturation_checks;    // Évaluations saturées consécutives avant verdict
+    float health_dead_fraction;      // Proportion d'unités mortes d'une couche cachée avant verdict
+    int health_plateau_epochs;       // Époques sans baisse relative de la loss avant verdict
+    float health_plateau_tolerance;  // Baisse relative minimale de la loss
+    int health_max_restarts;         // Redémarrages (nouvelle graine) avant abandon
+    
     // Configuration de l'optimisation adaptative
     int optimized_parameters;  // 0 = configuration statique, 1 = optimiseur temps réel
     
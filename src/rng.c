@@ -0,0 +1,194 @@
+#include "rng.h"
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#define RNG_TWO_PI 6.28318530717958647692f
+#define RNG_INV_2_24 (1.0f / 16777216.0f)
+
+static inline uint64_t rotl64(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+// splitmix64 : étale une graine quelconque (même 0) sur tout l'état
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+void rng_seed(Rng *rng, uint64_t seed) {
+    uint64_t x = seed;
+    for (int i = 0; i < 4; i++)
+        rng->s[i] = splitmix64(&x);
+    for (int i = 0; i < 4; i++) {
+        for (int l = 0; l < RNG_LANES; l += 2) {
+            uint64_t v = splitmix64(&x);
+            rng->lanes[i][l] = (uint32_t)v;
+            rng->lanes[i][l + 1] = (uint32_t)(v >> 32);
+        }
+    }
+    rng->spare_normal = 0.0f;
+    rng->has_spare = 0;
+}
+
+uint64_t rng_seed_from_rand(void) {
+    uint64_t hi = (uint64_t)rand();
+    uint64_t lo = (uint64_t)rand();
+    return (hi << 32) ^ lo;
+}
+
+// ============================================================================
+// TIRAGES SCALAIRES (xoshiro256**)
+// ============================================================================
+
+uint64_t rng_next_u64(Rng *rng) {
+    uint64_t *s = rng->s;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+float rng_uniform(Rng *rng) {
+    return (float)(rng_next_u64(rng) >> 40) * RNG_INV_2_24;
+}
+
+// Réduction multiplicative de Lemire : pas de division, biais < n / 2^64
+size_t rng_below(Rng *rng, size_t n) {
+    return (size_t)(((unsigned __int128)rng_next_u64(rng) * n) >> 64);
+}
+
+// Box-Muller polaire ; le second tirage est gardé dans l'état (pas de static)
+float rng_normal(Rng *rng) {
+    if (rng->has_spare) {
+        rng->has_spare = 0;
+        return rng->spare_normal;
+    }
+
+    float u, v, mag;
+    do {
+        u = 2.0f * rng_uniform(rng) - 1.0f;
+        v = 2.0f * rng_uniform(rng) - 1.0f;
+        mag = u * u + v * v;
+    } while (mag >= 1.0f || mag == 0.0f);
+
+    mag = sqrtf(-2.0f * logf(mag) / mag);
+    rng->spare_normal = v * mag;
+    rng->has_spare = 1;
+    return u * mag;
+}
+
+// ============================================================================
+// TIRAGES SUR TABLEAUX (RNG_LANES flux xoshiro128+)
+// ============================================================================
+// Les flux sont traités comme un vecteur de RNG_LANES entiers (extension
+// vectorielle de GCC) : une instruction SIMD par opération xoshiro, quel que
+// soit le jeu d'instructions (AVX2 : un registre, SSE : deux).
+
+typedef uint32_t rng_u32v __attribute__((vector_size(RNG_LANES * sizeof(uint32_t))));
+typedef int32_t rng_i32v __attribute__((vector_size(RNG_LANES * sizeof(int32_t))));
+typedef float rng_f32v __attribute__((vector_size(RNG_LANES * sizeof(float))));
+
+typedef struct { rng_u32v s0, s1, s2, s3; } LaneState;
+
+// Vecteurs passés par pointeur : pas de dépendance à l'ABI vectorielle (AVX ou non)
+static inline void lanes_load(const Rng *rng, LaneState *st) {
+    memcpy(&st->s0, rng->lanes[0], sizeof(rng_u32v));
+    memcpy(&st->s1, rng->lanes[1], sizeof(rng_u32v));
+    memcpy(&st->s2, rng->lanes[2], sizeof(rng_u32v));
+    memcpy(&st->s3, rng->lanes[3], sizeof(rng_u32v));
+}
+
+static inline void lanes_store(Rng *rng, const LaneState *st) {
+    memcpy(rng->lanes[0], &st->s0, sizeof(rng_u32v));
+    memcpy(rng->lanes[1], &st->s1, sizeof(rng_u32v));
+    memcpy(rng->lanes[2], &st->s2, sizeof(rng_u32v));
+    memcpy(rng->lanes[3], &st->s3, sizeof(rng_u32v));
+}
+
+// xoshiro128+ : les 24 bits de poids fort servent (bits faibles moins bons)
+static inline void lanes_next(LaneState *st, rng_u32v *bits) {
+    rng_u32v result = st->s0 + st->s3;
+    rng_u32v t = st->s1 << 9;
+    st->s2 ^= st->s0;
+    st->s3 ^= st->s1;
+    st->s1 ^= st->s2;
+    st->s0 ^= st->s3;
+    st->s2 ^= t;
+    st->s3 = (st->s3 << 11) | (st->s3 >> 21);
+    *bits = result >> 8;
+}
+
+static inline void lanes_uniform(LaneState *st, rng_f32v *u) {
+    rng_u32v bits;
+    lanes_next(st, &bits);
+    *u = __builtin_convertvector(bits, rng_f32v) * RNG_INV_2_24;
+}
+
+void rng_uniform_array(Rng *rng, float *dst, size_t n) {
+    LaneState st;
+    lanes_load(rng, &st);
+
+    size_t i = 0;
+    for (; i + RNG_LANES <= n; i += RNG_LANES) {
+        rng_f32v u;
+        lanes_uniform(&st, &u);
+        memcpy(dst + i, &u, sizeof(u));
+    }
+    if (i < n) {
+        rng_f32v u;
+        lanes_uniform(&st, &u);
+        memcpy(dst + i, &u, (n - i) * sizeof(float));
+    }
+
+    lanes_store(rng, &st);
+}
+
+// Box-Muller classique sur des paires d'uniformes (sans rejet, donc par lots)
+void rng_normal_array(Rng *rng, float *dst, size_t n, float mean, float std) {
+    size_t pairs = n / 2;
+    rng_uniform_array(rng, dst, 2 * pairs);
+
+    for (size_t k = 0; k < pairs; k++) {
+        float u1 = 1.0f - dst[2 * k];          // (0, 1] : log défini
+        float u2 = dst[2 * k + 1];
+        float r = sqrtf(-2.0f * logf(u1)) * std;
+        float angle = RNG_TWO_PI * u2;
+        dst[2 * k] = mean + r * cosf(angle);
+        dst[2 * k + 1] = mean + r * sinf(angle);
+    }
+    if (n & 1)
+        dst[n - 1] = mean + rng_normal(rng) * std;
+}
+
+// Comparaison entière sur 24 bits puis masque de bits : ni flottant ni branchement
+void rng_bernoulli_mask(Rng *rng, float *mask, size_t n, float p, float keep_value) {
+    uint32_t threshold = p <= 0.0f ? 0u : p >= 1.0f ? (1u << 24) : (uint32_t)(p * 16777216.0f);
+    uint32_t keep_bits;
+    memcpy(&keep_bits, &keep_value, sizeof(keep_bits));
+    LaneState st;
+    lanes_load(rng, &st);
+
+    size_t i = 0;
+    for (; i + RNG_LANES <= n; i += RNG_LANES) {
+        rng_u32v bits;
+        lanes_next(&st, &bits);
+        rng_i32v dropped = bits < threshold;                 // -1 si abandonné, 0 sinon
+        bits = keep_bits & ~(rng_u32v)dropped;
+        memcpy(mask + i, &bits, sizeof(bits));
+    }
+    if (i < n) {
+        rng_u32v bits;
+        lanes_next(&st, &bits);
+        rng_i32v dropped = bits < threshold;
+        bits = keep_bits & ~(rng_u32v)dropped;
+        memcpy(mask + i, &bits, (n - i) * sizeof(float));
+    }
+
+    lanes_store(rng, &st);
+}
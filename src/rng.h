@@ -0,0 +1,48 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// GÉNÉRATEUR PSEUDO-ALÉATOIRE EXPLICITE (xoshiro)
+// ============================================================================
+// Chaque réseau ou entraîneur possède son propre état : pas de verrou global
+// comme rand(), pas d'état statique partagé, et une graine par essai donne
+// exactement la même suite de tirages quel que soit le nombre de threads.
+//
+// - tirages scalaires (indices de mélange, valeurs isolées) : xoshiro256**
+// - tirages sur tableaux : RNG_LANES flux xoshiro128+ indépendants rangés
+//   en colonnes, que GCC vectorise (un flux par voie SIMD)
+
+#define RNG_LANES 8
+
+typedef struct {
+    uint64_t s[4];                   // État xoshiro256**
+    uint32_t lanes[4][RNG_LANES];    // États xoshiro128+ des flux vectoriels
+    float spare_normal;              // Second tirage de Box-Muller en attente
+    int has_spare;
+} Rng;
+
+// Initialiser tout l'état à partir d'une graine 64 bits (splitmix64)
+void rng_seed(Rng *rng, uint64_t seed);
+
+// Graine tirée du générateur global : les programmes qui fixent srand()
+// restent reproductibles sans connaître les états Rng
+uint64_t rng_seed_from_rand(void);
+
+// Tirages scalaires
+uint64_t rng_next_u64(Rng *rng);
+float rng_uniform(Rng *rng);                 // [0, 1)
+size_t rng_below(Rng *rng, size_t n);        // [0, n), n > 0
+float rng_normal(Rng *rng);                  // N(0, 1)
+
+// Tirages sur tableaux (flux vectoriels)
+void rng_uniform_array(Rng *rng, float *dst, size_t n);                       // [0, 1)
+void rng_normal_array(Rng *rng, float *dst, size_t n, float mean, float std); // N(mean, std²)
+
+// Masque de Bernoulli : mask[i] = 0 avec la probabilité p, keep_value sinon
+// (dropout inversé : keep_value = 1 / (1 - p))
+void rng_bernoulli_mask(Rng *rng, float *mask, size_t n, float p, float keep_value);
+
+#endif /* RNG_H */
@@ -0,0 +1,356 @@
+#include "sweep_executor.h"
+#include "thread_pool.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SWEEP_MAX_JOBS 256
+
+typedef struct {
+    size_t num_tasks;
+    size_t next_task;           // Accès atomique
+    SweepTaskFn fn;
+    void *ctx;
+} SweepRun;
+
+static void *sweep_worker(void *arg) {
+    SweepRun *run = arg;
+    thread_pool_set_inline(1);
+    for (;;) {
+        size_t task = __atomic_fetch_add(&run->next_task, 1, __ATOMIC_RELAXED);
+        if (task >= run->num_tasks) break;
+        run->fn(run->ctx, task);
+    }
+    thread_pool_set_inline(0);
+    return NULL;
+}
+
+int sweep_execute(size_t num_tasks, int num_jobs, SweepTaskFn fn, void *ctx) {
+    if (num_tasks == 0 || !fn) return 0;
+
+    if (num_jobs > SWEEP_MAX_JOBS) num_jobs = SWEEP_MAX_JOBS;
+    if ((size_t)num_jobs > num_tasks) num_jobs = (int)num_tasks;
+    if (num_jobs <= 1) {
+        for (size_t t = 0; t < num_tasks; t++)
+            fn(ctx, t);
+        return 1;
+    }
+
+    SweepRun run = { num_tasks, 0, fn, ctx };
+    pthread_t *threads = malloc((size_t)(num_jobs - 1) * sizeof(pthread_t));
+    int started = 0;
+    if (threads) {
+        for (; started < num_jobs - 1; started++) {
+            if (pthread_create(&threads[started], NULL, sweep_worker, &run) != 0) {
+                fprintf(stderr, "⚠️ Exécuteur : %d thread(s) créé(s) sur %d\n", started, num_jobs - 1);
+                break;
+            }
+        }
+    }
+
+    // Le thread appelant travaille aussi ; en cas d'échec de création, il finit seul
+    sweep_worker(&run);
+    for (int i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+    return started + 1;
+}
+
+// ============================================================================
+// ORDONNANCEMENT SELON LE COÛT
+// ============================================================================
+
+typedef struct {
+    size_t *tasks;              // Tranche de ScheduledRun.slots, ordre sans importance
+    size_t count;
+} WorkerQueue;
+
+typedef struct {
+    SweepTaskFn fn;
+    void *ctx;
+    SweepTaskInfo *tasks;
+    int num_workers;
+    double start;
+    
+    // Protégé par lock (pris seulement pour choisir une tâche ou en rendre compte)
+    pthread_mutex_t lock;
+    WorkerQueue *queues;
+    size_t *slots;
+    SweepCostRates *rates;      // Mesures des tâches terminées (appels précédents compris)
+    double busy_seconds;        // Durées des tâches de cet appel
+    double last_end;
+    size_t steals;
+} ScheduledRun;
+
+typedef struct {
+    ScheduledRun *run;
+    int id;
+} ScheduledWorker;
+
+typedef struct {
+    double cost;
+    size_t task;
+} CostRank;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static inline double task_cost(const SweepTaskInfo *info) {
+    return info->estimated_cost > 0.0 ? info->estimated_cost : 1.0;
+}
+
+static inline int task_class(const SweepTaskInfo *info) {
+    return (info->cost_class >= 0 && info->cost_class < SWEEP_MAX_COST_CLASSES) ? info->cost_class : 0;
+}
+
+// Durée prévue : coût x (secondes par unité mesurées sur la classe, à défaut sur
+// toutes les tâches finies). Sans aucune mesure, le coût brut sert d'échelle commune.
+// Une tâche rejouée est prévue à zéro.
+static double predicted_seconds(const ScheduledRun *run, size_t task) {
+    const SweepTaskInfo *info = &run->tasks[task];
+    const SweepCostRates *rates = run->rates;
+    if (info->replayed) return 0.0;
+    int c = task_class(info);
+    double rate = 1.0;
+    if (rates->class_cost[c] > 0.0) rate = rates->class_seconds[c] / rates->class_cost[c];
+    else if (rates->total_cost > 0.0) rate = rates->total_seconds / rates->total_cost;
+    return task_cost(info) * rate;
+}
+
+static void record_task(SweepCostRates *rates, const SweepTaskInfo *info) {
+    if (info->replayed) return;
+    rates->class_seconds[task_class(info)] += info->wall_seconds;
+    rates->class_cost[task_class(info)] += task_cost(info);
+    rates->total_seconds += info->wall_seconds;
+    rates->total_cost += task_cost(info);
+}
+
+// Retirer et renvoyer la tâche la plus longue d'une file (non vide)
+static size_t take_longest(const ScheduledRun *run, WorkerQueue *q) {
+    size_t best = 0;
+    double best_seconds = predicted_seconds(run, q->tasks[0]);
+    for (size_t i = 1; i < q->count; i++) {
+        double seconds = predicted_seconds(run, q->tasks[i]);
+        if (seconds > best_seconds) {
+            best = i;
+            best_seconds = seconds;
+        }
+    }
+    size_t task = q->tasks[best];
+    q->tasks[best] = q->tasks[--q->count];
+    return task;
+}
+
+// Sous le verrou : sa propre file d'abord, sinon vol chez le thread le plus chargé.
+// Retourne 0 quand il n'y a plus rien à faire.
+static int next_scheduled_task(ScheduledRun *run, int id, size_t *task) {
+    WorkerQueue *own = &run->queues[id];
+    if (own->count > 0) {
+        *task = take_longest(run, own);
+        return 1;
+    }
+    
+    int victim = -1;
+    double victim_seconds = 0.0;
+    for (int w = 0; w < run->num_workers; w++) {
+        const WorkerQueue *q = &run->queues[w];
+        double seconds = 0.0;
+        for (size_t i = 0; i < q->count; i++)
+            seconds += predicted_seconds(run, q->tasks[i]);
+        if (q->count > 0 && (victim < 0 || seconds > victim_seconds)) {
+            victim = w;
+            victim_seconds = seconds;
+        }
+    }
+    if (victim < 0) return 0;
+    *task = take_longest(run, &run->queues[victim]);
+    run->steals++;
+    return 1;
+}
+
+static void *scheduled_worker(void *arg) {
+    ScheduledWorker *worker = arg;
+    ScheduledRun *run = worker->run;
+    thread_pool_set_inline(1);
+    
+    pthread_mutex_lock(&run->lock);
+    size_t task;
+    while (next_scheduled_task(run, worker->id, &task)) {
+        pthread_mutex_unlock(&run->lock);
+        
+        double begin = now_seconds();
+        run->fn(run->ctx, task);
+        double end = now_seconds();
+        
+        pthread_mutex_lock(&run->lock);
+        SweepTaskInfo *info = &run->tasks[task];
+        info->wall_seconds = end - begin;
+        info->worker = worker->id;
+        record_task(run->rates, info);
+        run->busy_seconds += info->wall_seconds;
+        if (end > run->last_end) run->last_end = end;
+    }
+    pthread_mutex_unlock(&run->lock);
+    
+    thread_pool_set_inline(0);
+    return NULL;
+}
+
+static int compare_cost_desc(const void *a, const void *b) {
+    const CostRank *x = a, *y = b;
+    if (x->cost != y->cost) return x->cost < y->cost ? 1 : -1;
+    return (x->task > y->task) - (x->task < y->task);
+}
+
+// LPT : chaque tâche, de la plus longue à la plus courte (durée prévue d'après
+// les mesures des vagues précédentes), va au thread le moins chargé ; les files
+// sont ensuite rangées bout à bout dans run->slots
+static int assign_lpt(ScheduledRun *run, size_t num_tasks) {
+    CostRank *ranks = malloc(num_tasks * sizeof(CostRank));
+    int *owner = malloc(num_tasks * sizeof(int));
+    double *load = calloc((size_t)run->num_workers, sizeof(double));
+    if (!ranks || !owner || !load) {
+        free(ranks);
+        free(owner);
+        free(load);
+        return 0;
+    }
+    
+    for (size_t t = 0; t < num_tasks; t++) {
+        ranks[t].cost = predicted_seconds(run, t);
+        ranks[t].task = t;
+    }
+    qsort(ranks, num_tasks, sizeof(CostRank), compare_cost_desc);
+    
+    for (size_t r = 0; r < num_tasks; r++) {
+        int lightest = 0;
+        for (int w = 1; w < run->num_workers; w++)
+            if (load[w] < load[lightest]) lightest = w;
+        load[lightest] += ranks[r].cost;
+        owner[ranks[r].task] = lightest;
+        run->queues[lightest].count++;
+    }
+    
+    size_t offset = 0;
+    for (int w = 0; w < run->num_workers; w++) {
+        run->queues[w].tasks = run->slots + offset;
+        offset += run->queues[w].count;
+        run->queues[w].count = 0;
+    }
+    for (size_t t = 0; t < num_tasks; t++) {
+        WorkerQueue *q = &run->queues[owner[t]];
+        q->tasks[q->count++] = t;
+    }
+    
+    free(ranks);
+    free(owner);
+    free(load);
+    return 1;
+}
+
+int sweep_execute_scheduled(size_t num_tasks, int num_jobs, SweepTaskFn fn, void *ctx,
+                            SweepTaskInfo *tasks, SweepCostRates *rates, SweepScheduleStats *stats) {
+    if (stats) memset(stats, 0, sizeof(*stats));
+    if (num_tasks == 0 || !fn) return 0;
+    if (!tasks) return sweep_execute(num_tasks, num_jobs, fn, ctx);
+    
+    if (num_jobs > SWEEP_MAX_JOBS) num_jobs = SWEEP_MAX_JOBS;
+    if ((size_t)num_jobs > num_tasks) num_jobs = (int)num_tasks;
+    if (num_jobs < 1) num_jobs = 1;
+    
+    SweepCostRates local_rates;
+    if (!rates) {
+        memset(&local_rates, 0, sizeof(local_rates));
+        rates = &local_rates;
+    }
+    
+    double start = now_seconds();
+    if (num_jobs == 1) {
+        double busy = 0.0;
+        for (size_t t = 0; t < num_tasks; t++) {
+            double begin = now_seconds();
+            fn(ctx, t);
+            tasks[t].wall_seconds = now_seconds() - begin;
+            tasks[t].worker = 0;
+            record_task(rates, &tasks[t]);
+            busy += tasks[t].wall_seconds;
+        }
+        if (stats) {
+            stats->jobs = 1;
+            stats->makespan_seconds = now_seconds() - start;
+            stats->busy_seconds = busy;
+        }
+        return 1;
+    }
+    
+    ScheduledRun *run = calloc(1, sizeof(ScheduledRun));
+    if (run) {
+        run->queues = calloc((size_t)num_jobs, sizeof(WorkerQueue));
+        run->slots = malloc(num_tasks * sizeof(size_t));
+    }
+    ScheduledWorker *workers = malloc((size_t)num_jobs * sizeof(ScheduledWorker));
+    pthread_t *threads = malloc((size_t)num_jobs * sizeof(pthread_t));
+    if (run) {
+        run->fn = fn;
+        run->ctx = ctx;
+        run->tasks = tasks;
+        run->rates = rates;
+        run->num_workers = num_jobs;
+    }
+    if (!run || !run->queues || !run->slots || !workers || !threads || !assign_lpt(run, num_tasks)) {
+        fprintf(stderr, "⚠️ Exécuteur : mémoire insuffisante pour l'ordonnancement, répartition simple\n");
+        if (run) {
+            free(run->queues);
+            free(run->slots);
+        }
+        free(run);
+        free(workers);
+        free(threads);
+        return sweep_execute(num_tasks, num_jobs, fn, ctx);
+    }
+    pthread_mutex_init(&run->lock, NULL);
+    run->start = start;
+    run->last_end = start;
+    
+    // Les files des threads non créés restent disponibles au vol
+    int started = 1;
+    for (int w = 1; w < num_jobs; w++) {
+        workers[w].run = run;
+        workers[w].id = w;
+        if (pthread_create(&threads[w], NULL, scheduled_worker, &workers[w]) != 0) {
+            fprintf(stderr, "⚠️ Exécuteur : %d thread(s) créé(s) sur %d\n", started - 1, num_jobs - 1);
+            break;
+        }
+        started++;
+    }
+    workers[0].run = run;
+    workers[0].id = 0;
+    scheduled_worker(&workers[0]);
+    for (int w = 1; w < started; w++)
+        pthread_join(threads[w], NULL);
+    
+    if (stats) {
+        stats->jobs = started;
+        stats->makespan_seconds = run->last_end - run->start;
+        stats->busy_seconds = run->busy_seconds;
+        stats->steals = run->steals;
+    }
+    pthread_mutex_destroy(&run->lock);
+    free(run->queues);
+    free(run->slots);
+    free(run);
+    free(workers);
+    free(threads);
+    return started;
+}
+
+int sweep_default_jobs(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cores > 0) ? (int)cores : 1;
+}
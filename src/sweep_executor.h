@@ -0,0 +1,72 @@
+#ifndef SWEEP_EXECUTOR_H
+#define SWEEP_EXECUTOR_H
+
+#include <stddef.h>
+
+// ============================================================================
+// EXÉCUTEUR D'ESSAIS INDÉPENDANTS (--jobs N)
+// ============================================================================
+// Des tâches longues et indépendantes (un essai = un réseau entraîné) sont
+// réparties sur num_jobs threads dédiés, le thread appelant compris. Chaque
+// thread prend la tâche suivante dès qu'il a fini la sienne. Pendant le
+// balayage, les parallel_for appelés depuis les tâches s'exécutent en ligne :
+// le parallélisme est celui des essais, pas celui des produits matriciels.
+//
+// La fonction de tâche doit être sûre entre threads : elle n'écrit que dans
+// ses propres données, ou prend un verrou pour l'état partagé.
+
+typedef void (*SweepTaskFn)(void *ctx, size_t task);
+
+// Exécuter fn(ctx, t) pour t dans [0, num_tasks). num_jobs <= 1 : en série dans
+// l'ordre, dans le thread appelant. Retourne le nombre de threads réellement utilisés.
+int sweep_execute(size_t num_tasks, int num_jobs, SweepTaskFn fn, void *ctx);
+
+// ============================================================================
+// ORDONNANCEMENT SELON LE COÛT (tâches hétérogènes)
+// ============================================================================
+// Chaque tâche annonce un coût estimé (FLOPs, unités libres) et une classe de
+// coût. Les tâches sont d'abord réparties par LPT (la plus longue vers le
+// thread le moins chargé), chaque thread prend ensuite la plus longue de sa
+// file ; un thread sans travail vole la plus longue tâche du thread qui a le
+// plus de travail restant. Le temps mesuré de chaque tâche terminée corrige
+// les estimations des tâches encore en file de la même classe (secondes par
+// unité de coût) : les erreurs d'estimation, arrêts précoces compris, sont
+// rattrapées en cours de balayage. Une tâche rejouée (replayed) ne compte pas :
+// sa durée quasi nulle ferait croire sa classe bien plus rapide. Ces mesures (SweepCostRates) appartiennent à
+// l'appelant : d'une vague à la suivante, la répartition LPT part des durées
+// déjà observées. Objectif : le temps total (makespan).
+
+#define SWEEP_MAX_COST_CLASSES 64
+
+typedef struct {
+    double estimated_cost;      // Entrée : > 0 (sinon 1)
+    int cost_class;             // Entrée : [0, SWEEP_MAX_COST_CLASSES), sinon 0
+    int replayed;               // Entrée : résultat déjà connu (journal), durée prévue nulle et non mesurée
+    double wall_seconds;        // Sortie : durée mesurée
+    int worker;                 // Sortie : thread qui l'a exécutée
+} SweepTaskInfo;
+
+// Secondes mesurées et coût estimé cumulés, par classe et en tout (à zéro au départ)
+typedef struct {
+    double class_seconds[SWEEP_MAX_COST_CLASSES];
+    double class_cost[SWEEP_MAX_COST_CLASSES];
+    double total_seconds, total_cost;
+} SweepCostRates;
+
+typedef struct {
+    int jobs;                   // Threads réellement utilisés
+    double makespan_seconds;    // Du lancement à la fin de la dernière tâche
+    double busy_seconds;        // Somme des durées des tâches
+    size_t steals;              // Tâches prises dans la file d'un autre thread
+} SweepScheduleStats;
+
+// Comme sweep_execute, avec un coût par tâche (tasks[num_tasks]). num_jobs <= 1 :
+// en série dans l'ordre des indices (durées tout de même mesurées). rates : mesures
+// des appels précédents, complétées par celui-ci (NULL : aucune reprise). stats peut être NULL.
+int sweep_execute_scheduled(size_t num_tasks, int num_jobs, SweepTaskFn fn, void *ctx,
+                            SweepTaskInfo *tasks, SweepCostRates *rates, SweepScheduleStats *stats);
+
+// Nombre de jobs par défaut : cœurs disponibles
+int sweep_default_jobs(void);
+
+#endif /* SWEEP_EXECUTOR_H */
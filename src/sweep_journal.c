@@ -0,0 +1,183 @@
+#include "sweep_journal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <unistd.h>
+
+#define JOURNAL_LINE_MAX 512
+
+static int journal_push(SweepJournal *journal, const JournalTrial *entry) {
+    if (journal->count == journal->capacity) {
+        size_t capacity = journal->capacity ? journal->capacity * 2 : 256;
+        JournalTrial *entries = realloc(journal->entries, capacity * sizeof(JournalTrial));
+        if (!entries) return 0;
+        journal->entries = entries;
+        journal->capacity = capacity;
+    }
+    journal->entries[journal->count++] = *entry;
+    return 1;
+}
+
+// Une ligne T complète et bien formée, sinon 0
+static int parse_trial(const char *line, JournalTrial *t) {
+    memset(t, 0, sizeof(*t));
+    int consumed = 0;
+    int fields = sscanf(line, "T %" SCNx64 " %31s %31s %31s %d %d %" SCNu64 " %d %d %g %g %g %g %g %g %g %d %d %d%n",
+                        &t->config_hash, t->method, t->optimizer, t->activation,
+                        &t->trial, &t->epochs, &t->seed, &t->converged, &t->convergence_epoch,
+                        &t->final_loss, &t->lr, &t->accuracy, &t->precision, &t->recall,
+                        &t->f1_score, &t->auc_roc, &t->health, &t->restarts, &t->epochs_run, &consumed);
+    return fields == 19 && line[consumed] == '\n';
+}
+
+// Balayage en cours par configuration (dernière ligne S lue pour chaque hash)
+typedef struct {
+    uint64_t config_hash;
+    uint64_t base_seed;
+} JournalSweep;
+
+#define JOURNAL_MAX_SWEEPS 64
+
+// Lire les enregistrements du fichier ; filter = 0 : tous les essais.
+// Retourne 1 si le fichier se termine par une ligne complète (ou est vide).
+static int journal_read(SweepJournal *journal, FILE *file, int filter) {
+    char line[JOURNAL_LINE_MAX];
+    JournalSweep sweeps[JOURNAL_MAX_SWEEPS];
+    int num_sweeps = 0;
+    int complete = 1;
+    while (fgets(line, sizeof(line), file)) {
+        size_t len = strlen(line);
+        complete = len > 0 && line[len - 1] == '\n';
+        if (!complete) continue;
+
+        if (line[0] == 'S') {
+            uint64_t hash, seed;
+            if (sscanf(line, "S %" SCNx64 " %" SCNu64, &hash, &seed) != 2) continue;
+            if (hash == journal->config_hash)
+                journal->base_seed = seed;      // Le dernier balayage de cette configuration
+            int s = 0;
+            while (s < num_sweeps && sweeps[s].config_hash != hash) s++;
+            if (s == num_sweeps) {
+                if (num_sweeps == JOURNAL_MAX_SWEEPS) continue;
+                num_sweeps++;
+            }
+            sweeps[s].config_hash = hash;
+            sweeps[s].base_seed = seed;
+        } else if (line[0] == 'T') {
+            JournalTrial t;
+            if (!parse_trial(line, &t) || (filter && t.config_hash != journal->config_hash)) continue;
+            for (int s = 0; s < num_sweeps; s++)
+                if (sweeps[s].config_hash == t.config_hash) t.base_seed = sweeps[s].base_seed;
+            if (!journal_push(journal, &t)) break;
+        }
+    }
+    return complete;
+}
+
+static int journal_sync(SweepJournal *journal) {
+    if (fflush(journal->file) != 0) return 0;
+    return fsync(fileno(journal->file)) == 0;
+}
+
+int sweep_journal_open(SweepJournal *journal, const char *path, uint64_t config_hash,
+                       int resume, uint64_t new_seed) {
+    memset(journal, 0, sizeof(*journal));
+    pthread_mutex_init(&journal->lock, NULL);
+    journal->config_hash = config_hash;
+
+    int complete = 1;
+    FILE *existing = fopen(path, "r");
+    if (existing) {
+        complete = journal_read(journal, existing, 1);
+        fclose(existing);
+    }
+    if (!resume || journal->base_seed == 0) {
+        // Nouveau balayage : les essais d'un balayage précédent ne sont pas repris
+        journal->count = 0;
+        journal->base_seed = 0;
+    }
+    // Reprise : seuls les essais du dernier balayage de cette configuration comptent
+    size_t kept = 0;
+    for (size_t i = 0; i < journal->count; i++)
+        if (journal->entries[i].base_seed == journal->base_seed)
+            journal->entries[kept++] = journal->entries[i];
+    journal->count = kept;
+    journal->resumed = journal->count;
+
+    journal->file = fopen(path, "a");
+    if (!journal->file) {
+        printf("Erreur: impossible d'ouvrir le journal %s\n", path);
+        sweep_journal_close(journal);
+        return 0;
+    }
+    // Dernière ligne tronquée par un arrêt brutal : la terminer pour ne pas la prolonger
+    if (!complete) fputc('\n', journal->file);
+    if (journal->base_seed == 0) {
+        journal->base_seed = new_seed;
+        fprintf(journal->file, "S %016" PRIx64 " %" PRIu64 "\n", config_hash, new_seed);
+    }
+    if (!journal_sync(journal)) {
+        printf("Erreur: écriture impossible dans le journal %s\n", path);
+        sweep_journal_close(journal);
+        return 0;
+    }
+    return 1;
+}
+
+int sweep_journal_load(SweepJournal *journal, const char *path) {
+    memset(journal, 0, sizeof(*journal));
+    pthread_mutex_init(&journal->lock, NULL);
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        printf("Erreur: journal %s introuvable\n", path);
+        return 0;
+    }
+    journal_read(journal, file, 0);
+    fclose(file);
+    journal->resumed = journal->count;
+    if (journal->count > 0) {
+        journal->config_hash = journal->entries[journal->count - 1].config_hash;
+        journal->base_seed = journal->entries[journal->count - 1].base_seed;
+    }
+    return 1;
+}
+
+const JournalTrial *sweep_journal_find(SweepJournal *journal, const char *method,
+                                       const char *optimizer, const char *activation,
+                                       int trial, int epochs, uint64_t seed) {
+    const JournalTrial *found = NULL;
+    pthread_mutex_lock(&journal->lock);
+    for (size_t i = 0; i < journal->count; i++) {
+        const JournalTrial *t = &journal->entries[i];
+        if (t->seed == seed && t->trial == trial && t->epochs == epochs &&
+            strcmp(t->method, method) == 0 && strcmp(t->optimizer, optimizer) == 0 &&
+            strcmp(t->activation, activation) == 0) {
+            found = t;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&journal->lock);
+    return found;
+}
+
+int sweep_journal_append(SweepJournal *journal, const JournalTrial *entry) {
+    if (!journal->file) return 0;
+    pthread_mutex_lock(&journal->lock);
+    // %.9g : relecture exacte des flottants
+    fprintf(journal->file, "T %016" PRIx64 " %s %s %s %d %d %" PRIu64 " %d %d %.9g %.9g %.9g %.9g %.9g %.9g %.9g %d %d %d\n",
+            journal->config_hash, entry->method, entry->optimizer, entry->activation,
+            entry->trial, entry->epochs, entry->seed, entry->converged, entry->convergence_epoch,
+            entry->final_loss, entry->lr, entry->accuracy, entry->precision, entry->recall,
+            entry->f1_score, entry->auc_roc, entry->health, entry->restarts, entry->epochs_run);
+    int ok = journal_sync(journal);
+    // Pas de copie en mémoire : un essai ajouté n'est plus recherché pendant ce balayage
+    pthread_mutex_unlock(&journal->lock);
+    return ok;
+}
+
+void sweep_journal_close(SweepJournal *journal) {
+    if (journal->file) fclose(journal->file);
+    free(journal->entries);
+    pthread_mutex_destroy(&journal->lock);
+    memset(journal, 0, sizeof(*journal));
+}
@@ -0,0 +1,73 @@
+#ifndef SWEEP_JOURNAL_H
+#define SWEEP_JOURNAL_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+// ============================================================================
+// JOURNAL DU BALAYAGE (reprise après arrêt)
+// ============================================================================
+// Fichier texte en ajout seul, une ligne par enregistrement, vidé sur disque
+// (fsync) après chaque essai : un arrêt brutal (Ctrl-C, exit, préemption) ne
+// perd au pire que l'essai en cours. Deux enregistrements :
+//     S <hash config> <graine de base>                       début d'un balayage
+//     T <hash config> <méthode> <optimiseur> <activation> <essai> <époques>
+//       <graine> <convergé> <époque conv.> <loss> <lr> <acc> <préc> <rappel> <f1> <auc>
+//       <santé> <redémarrages> <époques menées>
+// Un essai est identifié par (méthode, optimiseur, activation, essai, époques,
+// graine, hash config). Une ligne incomplète (écriture interrompue) est ignorée.
+
+#define SWEEP_JOURNAL_NAME_LEN 32
+
+typedef struct {
+    uint64_t config_hash;
+    char method[SWEEP_JOURNAL_NAME_LEN];
+    char optimizer[SWEEP_JOURNAL_NAME_LEN];
+    char activation[SWEEP_JOURNAL_NAME_LEN];
+    int trial;
+    int epochs;                 // Budget d'époques de l'essai (palier)
+    uint64_t seed;
+    uint64_t base_seed;         // Balayage d'origine (ligne S précédente), renseigné à la lecture
+    int converged;
+    int convergence_epoch;
+    float final_loss;
+    float lr;
+    float accuracy, precision, recall, f1_score, auc_roc;
+    int health;                 // Verdict de la surveillance de santé (HealthStatus)
+    int restarts;
+    int epochs_run;
+} JournalTrial;
+
+typedef struct {
+    FILE *file;                 // NULL : journal en lecture seule ou désactivé
+    uint64_t config_hash;
+    uint64_t base_seed;         // Graine du balayage repris (0 si aucun)
+    JournalTrial *entries;      // Essais lus au chargement (config_hash, ou tous si lecture seule)
+    size_t count, capacity;
+    size_t resumed;             // Essais lus au chargement
+    pthread_mutex_t lock;
+} SweepJournal;
+
+// Ouvrir en ajout. resume = 1 : charger les essais de config_hash et reprendre
+// la graine du dernier balayage de cette configuration ; sinon (ou si aucun),
+// un nouveau balayage de graine new_seed est déclaré. Retourne 0 en cas d'échec.
+int sweep_journal_open(SweepJournal *journal, const char *path, uint64_t config_hash,
+                       int resume, uint64_t new_seed);
+
+// Lecture seule de tous les essais, toutes configurations (export) ; config_hash et
+// base_seed prennent les valeurs du dernier essai du fichier. Retourne 0 si illisible.
+int sweep_journal_load(SweepJournal *journal, const char *path);
+
+// Essai déjà terminé, ou NULL
+const JournalTrial *sweep_journal_find(SweepJournal *journal, const char *method,
+                                       const char *optimizer, const char *activation,
+                                       int trial, int epochs, uint64_t seed);
+
+// Ajouter un essai terminé (sûr entre threads) : écrit, vidé et synchronisé sur disque
+int sweep_journal_append(SweepJournal *journal, const JournalTrial *entry);
+
+void sweep_journal_close(SweepJournal *journal);
+
+#endif /* SWEEP_JOURNAL_H */
@@ -0,0 +1,174 @@
+#include "thread_pool.h"
+#include "memory.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <stdio.h>
+
+#define THREAD_POOL_MAX_THREADS 64
+
+// État du pool (protégé par pool_lock)
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t *workers = NULL;
+static int num_workers = 0;           // Threads du pool (hors thread appelant)
+static int requested_threads = 0;     // 0 = nombre de cœurs
+static int pool_started = 0;
+static int shutting_down = 0;
+static unsigned long generation = 0;  // Incrémenté à chaque nouvelle boucle
+static int pending_workers = 0;
+
+// Boucle en cours
+static ParallelForFn job_fn = NULL;
+static void *job_ctx = NULL;
+static size_t job_n = 0;
+static size_t job_grain = 1;
+static size_t job_chunks = 0;
+static size_t job_next_chunk = 0;     // Accès atomique
+
+// Un seul parallel_for actif à la fois ; les autres s'exécutent en ligne
+static pthread_mutex_t submit_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread int in_pool_worker = 0;
+
+static void run_chunks(void) {
+    for (;;) {
+        size_t chunk = __atomic_fetch_add(&job_next_chunk, 1, __ATOMIC_RELAXED);
+        if (chunk >= job_chunks) break;
+        size_t begin = chunk * job_grain;
+        size_t end = begin + job_grain;
+        if (end > job_n) end = job_n;
+        job_fn(job_ctx, begin, end);
+    }
+}
+
+// arg : génération courante à la création du thread. La relire au démarrage du
+// thread ferait manquer la première boucle si parallel_for l'a déjà incrémentée.
+static void *worker_main(void *arg) {
+    in_pool_worker = 1;
+    unsigned long seen = (unsigned long)(uintptr_t)arg;
+
+    pthread_mutex_lock(&pool_lock);
+    for (;;) {
+        while (!shutting_down && generation == seen)
+            pthread_cond_wait(&work_cond, &pool_lock);
+        if (shutting_down) break;
+        seen = generation;
+        pthread_mutex_unlock(&pool_lock);
+
+        run_chunks();
+
+        pthread_mutex_lock(&pool_lock);
+        if (--pending_workers == 0)
+            pthread_cond_signal(&done_cond);
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return NULL;
+}
+
+static int detect_threads(void) {
+    if (requested_threads > 0) return requested_threads;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cores > 0) ? (int)cores : 1;
+}
+
+// Démarrer les threads du pool (appelé avec submit_lock tenu)
+static void pool_start(void) {
+    int total = detect_threads();
+    if (total > THREAD_POOL_MAX_THREADS) total = THREAD_POOL_MAX_THREADS;
+
+    pthread_mutex_lock(&pool_lock);
+    shutting_down = 0;
+    // Seul parallel_for (sous submit_lock, tenu ici) incrémente generation
+    unsigned long start_generation = generation;
+    pthread_mutex_unlock(&pool_lock);
+
+    num_workers = 0;
+    if (total > 1) {
+        workers = mem_alloc((size_t)(total - 1) * sizeof(pthread_t));
+        for (int i = 0; i < total - 1; i++) {
+            if (pthread_create(&workers[i], NULL, worker_main, (void *)(uintptr_t)start_generation) != 0) {
+                fprintf(stderr, "⚠️ Pool de threads : %d thread(s) créé(s) sur %d\n", i, total - 1);
+                break;
+            }
+            num_workers++;
+        }
+    }
+    pool_started = 1;
+}
+
+void parallel_for(size_t n, size_t grain, ParallelForFn fn, void *ctx) {
+    if (n == 0) return;
+    if (grain == 0) grain = 1;
+
+    // Boucle trop courte, appel imbriqué ou pool occupé : exécution directe
+    if (n <= grain || in_pool_worker || pthread_mutex_trylock(&submit_lock) != 0) {
+        fn(ctx, 0, n);
+        return;
+    }
+
+    if (!pool_started) pool_start();
+    if (num_workers == 0) {
+        pthread_mutex_unlock(&submit_lock);
+        fn(ctx, 0, n);
+        return;
+    }
+
+    pthread_mutex_lock(&pool_lock);
+    job_fn = fn;
+    job_ctx = ctx;
+    job_n = n;
+    job_grain = grain;
+    job_chunks = (n + grain - 1) / grain;
+    __atomic_store_n(&job_next_chunk, 0, __ATOMIC_RELAXED);
+    pending_workers = num_workers;
+    generation++;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&pool_lock);
+
+    // Le thread appelant participe au travail
+    in_pool_worker = 1;
+    run_chunks();
+    in_pool_worker = 0;
+
+    pthread_mutex_lock(&pool_lock);
+    while (pending_workers > 0)
+        pthread_cond_wait(&done_cond, &pool_lock);
+    pthread_mutex_unlock(&pool_lock);
+
+    pthread_mutex_unlock(&submit_lock);
+}
+
+void thread_pool_set_inline(int enable) {
+    in_pool_worker = enable ? 1 : 0;
+}
+
+void thread_pool_set_threads(int num_threads) {
+    pthread_mutex_lock(&submit_lock);
+    requested_threads = (num_threads > 0) ? num_threads : 0;
+    pthread_mutex_unlock(&submit_lock);
+}
+
+int thread_pool_num_threads(void) {
+    if (pool_started) return num_workers + 1;
+    int total = detect_threads();
+    return (total > THREAD_POOL_MAX_THREADS) ? THREAD_POOL_MAX_THREADS : total;
+}
+
+void thread_pool_shutdown(void) {
+    pthread_mutex_lock(&submit_lock);
+    if (pool_started) {
+        pthread_mutex_lock(&pool_lock);
+        shutting_down = 1;
+        pthread_cond_broadcast(&work_cond);
+        pthread_mutex_unlock(&pool_lock);
+
+        for (int i = 0; i < num_workers; i++)
+            pthread_join(workers[i], NULL);
+        mem_free(workers);
+        workers = NULL;
+        num_workers = 0;
+        pool_started = 0;
+    }
+    pthread_mutex_unlock(&submit_lock);
+}
@@ -0,0 +1,30 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+// Corps d'une boucle parallèle : traite les indices [begin, end)
+typedef void (*ParallelForFn)(void *ctx, size_t begin, size_t end);
+
+// Exécuter fn sur [0, n) découpé en tranches d'au plus grain indices.
+// Les tranches sont distribuées dynamiquement entre le thread appelant et les
+// threads du pool (créé au premier appel). Si le pool est déjà occupé (appel
+// imbriqué ou depuis un autre thread) ou si n <= grain, la boucle s'exécute
+// directement dans le thread appelant : l'appel est donc toujours sûr.
+void parallel_for(size_t n, size_t grain, ParallelForFn fn, void *ctx);
+
+// Nombre de threads utilisés par parallel_for (thread appelant compris).
+// 0 = nombre de cœurs disponibles. À appeler avant le premier parallel_for
+// ou après thread_pool_shutdown.
+void thread_pool_set_threads(int num_threads);
+int thread_pool_num_threads(void);
+
+// Exécuter en ligne les parallel_for du thread appelant (enable = 1) : pour les
+// threads qui forment déjà un niveau de parallélisme (essais concurrents) et ne
+// doivent pas se disputer le pool
+void thread_pool_set_inline(int enable);
+
+// Arrêter et libérer les threads du pool (recréé au besoin par parallel_for)
+void thread_pool_shutdown(void);
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,119 @@
+#include "health_monitor.h"
+#include <math.h>
+#include <string.h>
+
+int health_monitor_init(HealthMonitor *monitor, const RichConfig *config, const NeuralNetwork *net,
+                        float **probe_inputs, size_t num_samples) {
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->config = config;
+    monitor->probe_inputs = probe_inputs;
+    monitor->num_probes = num_samples < HEALTH_PROBE_SAMPLES ? num_samples : HEALTH_PROBE_SAMPLES;
+    return health_monitor_restart(monitor, net);
+}
+
+int health_monitor_restart(HealthMonitor *monitor, const NeuralNetwork *net) {
+    if (monitor->probe_ctx) inference_context_free(monitor->probe_ctx);
+    monitor->net = net;
+    monitor->probe_ctx = inference_context_create(net);
+    monitor->best_loss = INFINITY;
+    monitor->best_loss_epoch = 0;
+    monitor->saturated_checks = 0;
+    monitor->converged = 0;
+    monitor->status = HEALTH_OK;
+    monitor->status_epoch = -1;
+    return monitor->probe_ctx != NULL;
+}
+
+static HealthStatus health_verdict(HealthMonitor *monitor, int epoch, HealthStatus status) {
+    if (monitor->status == HEALTH_OK && status != HEALTH_OK) {
+        monitor->status = status;
+        monitor->status_epoch = epoch;
+    }
+    return monitor->status;
+}
+
+// Paramètres finis : un seul passage sur l'arène (poids et biais de toutes les couches)
+static int network_params_finite(const NeuralNetwork *net) {
+    const ParamArena *arena = net->arena;
+    if (!arena) return 1;
+    float sum = 0.0f;
+    for (size_t i = 0; i < arena->size; i++) sum += arena->params[i] * 0.0f;
+    return sum == 0.0f;   // NaN ou Inf * 0 = NaN, qui se propage dans la somme
+}
+
+HealthStatus health_monitor_epoch(HealthMonitor *monitor, int epoch, float loss) {
+    const RichConfig *config = monitor->config;
+    if (!config->health_monitor || monitor->status != HEALTH_OK) return monitor->status;
+
+    // Divergence : décidée sans attendre, rien ne se rattrape après un NaN
+    if (!isfinite(loss) || !network_params_finite(monitor->net)) {
+        return health_verdict(monitor, epoch, HEALTH_NONFINITE);
+    }
+
+    if (loss < monitor->best_loss * (1.0f - config->health_plateau_tolerance)) {
+        monitor->best_loss = loss;
+        monitor->best_loss_epoch = epoch;
+    }
+    if (epoch < config->health_warmup_epochs) return HEALTH_OK;
+
+    if (!monitor->converged && config->health_plateau_epochs > 0 && epoch - monitor->best_loss_epoch >= config->health_plateau_epochs) {
+        return health_verdict(monitor, epoch, HEALTH_PLATEAU);
+    }
+
+    if (monitor->probe_ctx && monitor->num_probes > 0 && config->health_check_interval > 0 &&
+        epoch % config->health_check_interval == 0) {
+        float dead = network_dead_fraction_simple(monitor->net, monitor->probe_ctx,
+                                                  monitor->probe_inputs, monitor->num_probes);
+        if (dead >= config->health_dead_fraction) return health_verdict(monitor, epoch, HEALTH_DEAD_UNITS);
+    }
+    return HEALTH_OK;
+}
+
+HealthStatus health_monitor_scores(HealthMonitor *monitor, int epoch, float score_min, float score_max,
+                                   int nonfinite_scores) {
+    const RichConfig *config = monitor->config;
+    if (!config->health_monitor || monitor->status != HEALTH_OK) return monitor->status;
+
+    if (nonfinite_scores > 0) return health_verdict(monitor, epoch, HEALTH_NONFINITE);
+
+    if (score_max - score_min < config->health_saturation_range) {
+        monitor->saturated_checks++;
+    } else {
+        monitor->saturated_checks = 0;
+    }
+    if (epoch >= config->health_warmup_epochs && config->health_saturation_checks > 0 &&
+        monitor->saturated_checks >= config->health_saturation_checks) {
+        return health_verdict(monitor, epoch, HEALTH_SATURATED);
+    }
+    return HEALTH_OK;
+}
+
+HealthStatus health_monitor_converged(HealthMonitor *monitor) {
+    monitor->converged = 1;
+    if (monitor->status == HEALTH_PLATEAU) {
+        monitor->status = HEALTH_OK;
+        monitor->status_epoch = -1;
+    }
+    return monitor->status;
+}
+
+int health_status_restartable(HealthStatus status) {
+    // Une loss immobile n'a rien d'accidentel : un autre tirage n'y change rien
+    return status == HEALTH_NONFINITE || status == HEALTH_SATURATED || status == HEALTH_DEAD_UNITS;
+}
+
+const char *health_status_name(HealthStatus status) {
+    switch (status) {
+        case HEALTH_OK: return "sain";
+        case HEALTH_NONFINITE: return "nan_inf";
+        case HEALTH_SATURATED: return "sature";
+        case HEALTH_DEAD_UNITS: return "unites_mortes";
+        case HEALTH_PLATEAU: return "plateau";
+        default: return "inconnu";
+    }
+}
+
+void health_monitor_free(HealthMonitor *monitor) {
+    if (monitor->probe_ctx) inference_context_free(monitor->probe_ctx);
+    memset(monitor, 0, sizeof(*monitor));
+}
@@ -0,0 +1,71 @@
+#ifndef HEALTH_MONITOR_H
+#define HEALTH_MONITOR_H
+
+#include <stddef.h>
+#include "../neural/network.h"
+#include "../neural/network_simple.h"
+#include "../rich_config.h"
+
+// ============================================================================
+// SURVEILLANCE DE SANTÉ D'UN ESSAI
+// ============================================================================
+// Alimentée à chaque époque par la loss et le réseau, et à chaque évaluation par
+// la plage des scores. Un verdict autre que HEALTH_OK signale un essai déjà
+// perdu : poids ou loss non finis, sorties saturées, couche cachée effondrée
+// (unités mortes) ou loss immobile. Seuils lus dans le YAML (clés health_*).
+// Une loss immobile n'est un échec qu'avant la convergence : un essai convergé
+// ou arrêté par early stopping a simplement fini d'apprendre.
+
+typedef enum {
+    HEALTH_OK,
+    HEALTH_NONFINITE,           // Poids, loss ou scores NaN/Inf
+    HEALTH_SATURATED,           // Scores dans une plage quasi nulle, évaluation après évaluation
+    HEALTH_DEAD_UNITS,          // Une couche cachée presque entièrement morte
+    HEALTH_PLATEAU,             // Loss sans baisse relative sur health_plateau_epochs
+    HEALTH_STATUS_COUNT
+} HealthStatus;
+
+typedef struct {
+    const RichConfig *config;
+    const NeuralNetwork *net;
+    InferenceContext *probe_ctx;
+    float **probe_inputs;       // Échantillons du sondage des unités mortes (non possédés)
+    size_t num_probes;
+
+    float best_loss;
+    int best_loss_epoch;
+    int saturated_checks;
+    int converged;              // Essai convergé : plus de verdict plateau
+    HealthStatus status;
+    int status_epoch;           // Époque du verdict (-1 : aucun)
+} HealthMonitor;
+
+#define HEALTH_PROBE_SAMPLES 64
+
+// Surveiller net ; probe_inputs : lignes d'entraînement pour le sondage (au plus
+// HEALTH_PROBE_SAMPLES utilisées). Retourne 0 si le contexte d'inférence manque.
+int health_monitor_init(HealthMonitor *monitor, const RichConfig *config, const NeuralNetwork *net,
+                        float **probe_inputs, size_t num_samples);
+
+// Repartir de zéro sur un nouveau réseau (essai redémarré)
+int health_monitor_restart(HealthMonitor *monitor, const NeuralNetwork *net);
+
+// Fin d'époque : loss moyenne de l'époque. Retourne le verdict (HEALTH_OK : continuer).
+HealthStatus health_monitor_epoch(HealthMonitor *monitor, int epoch, float loss);
+
+// Après une évaluation : plage des scores et nombre de scores non finis
+HealthStatus health_monitor_scores(HealthMonitor *monitor, int epoch, float score_min, float score_max,
+                                   int nonfinite_scores);
+
+// Essai convergé ou arrêté par early stopping : un plateau déjà constaté est
+// levé et n'est plus signalé. Retourne le verdict restant.
+HealthStatus health_monitor_converged(HealthMonitor *monitor);
+
+// Le verdict justifie-t-il un redémarrage (réseau mal initialisé) plutôt qu'un abandon ?
+int health_status_restartable(HealthStatus status);
+
+const char *health_status_name(HealthStatus status);
+
+void health_monitor_free(HealthMonitor *monitor);
+
+#endif /* HEALTH_MONITOR_H */
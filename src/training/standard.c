@@ -68,7 +68,7 @@ void train_standard(Trainer *trainer, Dataset *dataset) {
     
     // Mélanger le dataset équilibré
     for (size_t i = total_balanced_samples - 1; i > 0; i--) {
-        size_t j = rand() % (i + 1);
+        size_t j = rng_below(&trainer->rng, i + 1);
         size_t temp = balanced_indices[i];
         balanced_indices[i] = balanced_indices[j];
         balanced_indices[j] = temp;
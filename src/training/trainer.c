@@ -53,6 +53,21 @@ OptimizerUpdateFn trainer_get_optimizer_update(const char *optimizer) {
     return NULL;
 }
 
+// Libération de l'état selon l'optimiseur (moments m, v, etc. compris)
+void trainer_free_optimizer_state(const char *optimizer, void *state) {
+    if (!state) return;
+    if (strcmp(optimizer, "sgd") == 0)            sgd_free((SGDState*)state);
+    else if (strcmp(optimizer, "adam") == 0)      adam_free((AdamState*)state);
+    else if (strcmp(optimizer, "adamw") == 0)     adamw_free((AdamWState*)state);
+    else if (strcmp(optimizer, "rmsprop") == 0)   rmsprop_free((RMSPropState*)state);
+    else if (strcmp(optimizer, "lion") == 0)      lion_free((LionState*)state);
+    else if (strcmp(optimizer, "adabelief") == 0) adabelief_free((AdaBeliefState*)state);
+    else if (strcmp(optimizer, "radam") == 0)     radam_free((RAdamState*)state);
+    else if (strcmp(optimizer, "adamax") == 0)    adamax_free((AdamaxState*)state);
+    else if (strcmp(optimizer, "nadam") == 0)     nadam_free((NadamState*)state);
+    else free(state);
+}
+
 // Création du trainer
 Trainer *trainer_create(NeuralNetwork *net,
                         const char *optimizer,
@@ -71,16 +86,21 @@ Trainer *trainer_create(NeuralNetwork *net,
     t->optimizer_state = optimizer_state;
     t->optimizer_update = optimizer_update;
     t->progress_bar_id = -1; // Pas de barre de progression par défaut
+    rng_seed(&t->rng, rng_seed_from_rand());
     strncpy(t->optimizer_name, optimizer, sizeof(t->optimizer_name)-1);
     strncpy(t->strategy_name, "custom", sizeof(t->strategy_name)-1);
     return t;
 }
 
+void trainer_seed(Trainer *t, uint64_t seed) {
+    if (t) rng_seed(&t->rng, seed);
+}
+
 void trainer_free(Trainer *t) {
     if (t) {
         // Libérer l'état de l'optimiseur si il existe
         if (t->optimizer_state) {
-            free(t->optimizer_state);
+            trainer_free_optimizer_state(t->optimizer_name, t->optimizer_state);
         }
         free(t);
     }
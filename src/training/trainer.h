@@ -4,6 +4,7 @@
 #include "../neural/network.h"
 #include "../data/dataset.h"
 #include "../optimizers/optimizer.h"
+#include "../rng.h"
 
 // Pointeur de fonction pour mise à jour optimiseur
 typedef void (*OptimizerUpdateFn)(void *state, float *weights, float *gradients);
@@ -28,6 +29,7 @@ struct Trainer {
     char strategy_name[32];
     char optimizer_name[32];
     int progress_bar_id;  // ID de la barre de progression pour cet entraînement
+    Rng rng;              // Tirages de l'entraînement (mélanges), propres à ce trainer
 };
 
 // Création générique du trainer selon optimizer et méthode
@@ -46,6 +48,9 @@ Trainer *trainer_create(NeuralNetwork *net,
 void trainer_train(Trainer *trainer, Dataset *dataset);
 float trainer_validate(Trainer *trainer, Dataset *dataset);
 
+// Réensemencer les tirages du trainer (une graine par essai)
+void trainer_seed(Trainer *trainer, uint64_t seed);
+
 // Libération
 void trainer_free(Trainer *trainer);
 
@@ -53,5 +58,6 @@ void trainer_free(Trainer *trainer);
 // Helpers pour mapping string->optimizer
 void *trainer_create_optimizer_state(const char *optimizer, size_t num_weights, float lr);
 OptimizerUpdateFn trainer_get_optimizer_update(const char *optimizer);
+void trainer_free_optimizer_state(const char *optimizer, void *state);
 
 #endif
\ No newline at end of file
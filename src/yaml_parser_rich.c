@@ -144,7 +144,17 @@ int parse_yaml_rich(const char *filename, RichConfig *cfg) {
     cfg->learning_rate = 0.001f;
     cfg->early_stopping = 1;
     cfg->patience = 20;
+    cfg->health_monitor = 1;
+    cfg->health_warmup_epochs = 10;       // Comme l'early stopping : rien avant l'époque 10
+    cfg->health_check_interval = 5;
+    cfg->health_saturation_range = 0.001f;  // Même seuil que compute_all_metrics
+    cfg->health_saturation_checks = 10;
+    cfg->health_dead_fraction = 0.95f;
+    cfg->health_plateau_epochs = 30;
+    cfg->health_plateau_tolerance = 0.001f;
+    cfg->health_max_restarts = 0;         // Abandon direct : un autre tirage sature presque toujours aussi
     cfg->optimized_parameters = 0;
+    cfg->dataset_cache = 1;            // Cache binaire du dataset traité à côté du CSV
     cfg->debug_mode = 0;               // Messages debug masqués par défaut
     cfg->input_cols = 10;
     cfg->output_cols = 1;
@@ -265,6 +275,43 @@ int parse_yaml_rich(const char *filename, RichConfig *cfg) {
                     cfg->early_stopping = (strstr(v, "true") || strstr(v, "yes") || strstr(v, "1")) ? 1 : 0;
                     current_list_type[0] = '\0';
                 }
+                // Surveillance de santé des essais
+                else if (strcmp(k, "health_monitor") == 0) {
+                    cfg->health_monitor = (strstr(v, "true") || strstr(v, "yes") || strstr(v, "1")) ? 1 : 0;
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_warmup_epochs") == 0) {
+                    cfg->health_warmup_epochs = atoi(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_check_interval") == 0) {
+                    cfg->health_check_interval = atoi(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_saturation_range") == 0) {
+                    cfg->health_saturation_range = atof(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_saturation_checks") == 0) {
+                    cfg->health_saturation_checks = atoi(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_dead_fraction") == 0) {
+                    cfg->health_dead_fraction = atof(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_plateau_epochs") == 0) {
+                    cfg->health_plateau_epochs = atoi(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_plateau_tolerance") == 0) {
+                    cfg->health_plateau_tolerance = atof(v);
+                    current_list_type[0] = '\0';
+                }
+                else if (strcmp(k, "health_max_restarts") == 0) {
+                    cfg->health_max_restarts = atoi(v);
+                    current_list_type[0] = '\0';
+                }
                 else if (strcmp(k, "optimized_parameters") == 0) {
                     cfg->optimized_parameters = (strstr(v, "true") || strstr(v, "yes") || strstr(v, "1")) ? 1 : 0;
                     current_list_type[0] = '\0';
@@ -354,6 +401,10 @@ int parse_yaml_rich(const char *filename, RichConfig *cfg) {
                     clean_value(cfg->field_detection);
                     current_list_type[0] = '\0';
                 }
+                else if (strcmp(k, "dataset_cache") == 0) {
+                    cfg->dataset_cache = (strstr(v, "true") || strstr(v, "yes") || strstr(v, "1")) ? 1 : 0;
+                    current_list_type[0] = '\0';
+                }
                 else {
                     current_list_type[0] = '\0';  // Clé non reconnue, sortir du mode liste
                 }
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "src/math_utils.h"
+#include "src/neural/activation.h"
+
+// Erreur relative maximale d'une approximation sur [lo, hi] (grille dense)
+static double sweep_rel_error(float (*approx)(float), double (*reference)(double),
+                              float lo, float hi, long steps) {
+    double worst = 0.0;
+    for (long i = 0; i <= steps; i++) {
+        float x = lo + (hi - lo) * (float)((double)i / steps);
+        double ref = reference(x);
+        double err = fabs((double)approx(x) - ref);
+        if (ref != 0.0) err /= fabs(ref);
+        if (err > worst) worst = err;
+    }
+    return worst;
+}
+
+static float f_exp(float x) { return approx_exp(x); }
+static float f_sigmoid(float x) { return approx_sigmoid(x); }
+static float f_tanh(float x) { return approx_tanh(x); }
+static float f_log1p(float x) { return approx_log1p(x); }
+static double d_sigmoid(double x) { return 1.0 / (1.0 + exp(-x)); }
+
+static int check_bound(const char *name, double err, double bound) {
+    int ok = err < bound;
+    printf("   %s %-8s erreur relative max = %.2e (borne %.0e)\n", ok ? "✅" : "❌", name, err, bound);
+    return ok;
+}
+
+// Référence libm en double pour chaque activation
+static double reference_activation(int type, double x) {
+    switch (type) {
+        case ACTIVATION_RELU: return x > 0 ? x : 0;
+        case ACTIVATION_SIGMOID: return d_sigmoid(x);
+        case ACTIVATION_TANH: return tanh(x);
+        case ACTIVATION_LEAKY_RELU:
+        case ACTIVATION_PRELU: return x > 0 ? x : 0.01 * x;
+        case ACTIVATION_LINEAR: return x;
+        case ACTIVATION_GELU: return 0.5 * x * (1.0 + tanh(0.7978845608 * (x + 0.044715 * x * x * x)));
+        case ACTIVATION_MISH: return x * tanh(log1p(exp(fmin(x, 20.0))));
+        case ACTIVATION_SWISH: return x * d_sigmoid(x);
+        case ACTIVATION_ELU: return x > 0 ? x : exp(x) - 1.0;
+        default:
+            if (x > 1.0) return x;
+            if (x < -1.0) return tanh(x);
+            return 0.5 * (x + tanh(x));
+    }
+}
+
+static int check_activations(void) {
+    static const char *names[] = { "relu", "sigmoid", "gelu", "neuroplast", "leaky_relu",
+                                   "elu", "mish", "swish", "prelu", "tanh", "linear" };
+    size_t n = 100001;
+    float *z = malloc(n * sizeof(float));
+    float *out = malloc(n * sizeof(float));
+    for (size_t i = 0; i < n; i++)
+        z[i] = -30.0f + 60.0f * (float)i / (float)(n - 1);
+
+    int ok = 1;
+    for (int type = 0; type <= ACTIVATION_LINEAR; type++) {
+        activation_forward_array(type, z, out, n);
+        double worst = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double ref = reference_activation(type, z[i]);
+            double err = fabs(out[i] - ref) / (fabs(ref) + 1e-6);
+            if (err > worst) worst = err;
+        }
+        int pass = worst < 1e-5;
+        ok &= pass;
+        printf("   %s %-10s erreur relative max = %.2e\n", pass ? "✅" : "❌", names[type], worst);
+    }
+    free(z);
+    free(out);
+    return ok;
+}
+
+// Dérivées exactes de la passe avant : comparaison aux différences centrées
+// de la référence double (points proches des coudes exclus)
+static int check_derivatives(void) {
+    size_t n = 20001;
+    float *z = malloc(n * sizeof(float));
+    float *out = malloc(n * sizeof(float));
+    float *deriv = malloc(n * sizeof(float));
+    for (size_t i = 0; i < n; i++)
+        z[i] = -10.0f + 20.0f * (float)i / (float)(n - 1) + 1.7e-4f;
+
+    int ok = 1;
+    for (int type = 0; type <= ACTIVATION_LINEAR; type++) {
+        const ActivationKernels *kernels = activation_kernels(type);
+        kernels->forward_derivative(z, out, deriv, n);
+        double worst = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double x = z[i], h = 1e-5;
+            if (fabs(x) < 1e-3 || fabs(fabs(x) - 1.0) < 1e-3) continue;
+            double numeric = (reference_activation(type, x + h) - reference_activation(type, x - h)) / (2.0 * h);
+            double err = fabs(deriv[i] - numeric);
+            if (err > worst) worst = err;
+        }
+        int pass = worst < 1e-4;
+        ok &= pass;
+        printf("   %s %-10s f'(z) erreur absolue max = %.2e%s\n", pass ? "✅" : "❌", kernels->name, worst,
+               kernels->caches_derivative ? " (gardée en cache)" : "");
+    }
+    free(z);
+    free(out);
+    free(deriv);
+    return ok;
+}
+
+// Débit du noyau sur tableau face à la boucle libm élément par élément
+static void benchmark(void) {
+    size_t n = 1 << 16;
+    int reps = 400;
+    float *z = malloc(n * sizeof(float));
+    float *out = malloc(n * sizeof(float));
+    for (size_t i = 0; i < n; i++) z[i] = ((float)rand() / RAND_MAX - 0.5f) * 12.0f;
+
+    int types[] = { ACTIVATION_GELU, ACTIVATION_MISH, ACTIVATION_SWISH, ACTIVATION_TANH };
+    const char *names[] = { "gelu", "mish", "swish", "tanh" };
+    for (int t = 0; t < 4; t++) {
+        clock_t start = clock();
+        for (int r = 0; r < reps; r++) {
+            for (size_t i = 0; i < n; i++) {
+                float x = z[i];
+                switch (types[t]) {
+                    case ACTIVATION_GELU: out[i] = 0.5f * x * (1.0f + tanhf(0.7978845608f * (x + 0.044715f * x * x * x))); break;
+                    case ACTIVATION_MISH: out[i] = x * tanhf(logf(1.0f + expf(fminf(x, 20.0f)))); break;
+                    case ACTIVATION_SWISH: out[i] = x / (1.0f + expf(-x)); break;
+                    default: out[i] = tanhf(x); break;
+                }
+            }
+        }
+        double scalar_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        start = clock();
+        for (int r = 0; r < reps; r++)
+            activation_forward_array(types[t], z, out, n);
+        double array_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        printf("   %-6s libm %.2f ns/élément | tableau %.2f ns/élément (x%.1f)\n", names[t],
+               scalar_s * 1e9 / ((double)n * reps), array_s * 1e9 / ((double)n * reps),
+               array_s > 0 ? scalar_s / array_s : 0.0);
+    }
+    free(z);
+    free(out);
+}
+
+int main(void) {
+    int ok = 1;
+    printf("🧪 Approximations polynomiales\n");
+    ok &= check_bound("exp", sweep_rel_error(f_exp, exp, -87.0f, 88.0f, 4000000), 1e-7);
+    ok &= check_bound("sigmoid", sweep_rel_error(f_sigmoid, d_sigmoid, -80.0f, 80.0f, 4000000), 2e-7);
+    ok &= check_bound("tanh", sweep_rel_error(f_tanh, tanh, -20.0f, 20.0f, 4000000), 2e-7);
+    ok &= check_bound("log1p", sweep_rel_error(f_log1p, log1p, -0.999f, 1000.0f, 4000000), 2e-7);
+
+    printf("🧪 Noyaux d'activation sur tableaux\n");
+    ok &= check_activations();
+
+    printf("🧪 Dérivées exactes de la passe avant\n");
+    ok &= check_derivatives();
+
+    printf("⏱️  Débit\n");
+    benchmark();
+
+    printf(ok ? "✅ Tous les tests d'activation réussis\n" : "❌ Échec des tests d'activation\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdio.h>
+
+// Une ligne ✅/❌ par vérification ; retourne ok pour cumuler : ok &= test_check(...)
+static inline int test_check(int ok, const char *what) {
+    printf("   %s %s\n", ok ? "✅" : "❌", what);
+    return ok;
+}
+
+#endif /* TEST_COMMON_H */
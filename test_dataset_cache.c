@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "src/data/dataset_cache.h"
+#include "test_common.h"
+
+#define SAMPLES 50
+#define INPUTS 3
+#define OUTPUTS 1
+
+static int write_text(const char *path, const char *text) {
+    FILE *file = fopen(path, "w");
+    if (!file) return 0;
+    fputs(text, file);
+    return fclose(file) == 0;
+}
+
+static void setup_analyzer(DatasetAnalyzer *analyzer) {
+    memset(analyzer, 0, sizeof(*analyzer));
+    strcpy(analyzer->input_fields[0], "age");
+    strcpy(analyzer->input_fields[1], "bmi");
+    strcpy(analyzer->input_fields[2], "smoker");
+    strcpy(analyzer->output_fields[0], "outcome");
+    analyzer->num_input_fields = INPUTS;
+    analyzer->num_output_fields = OUTPUTS;
+}
+
+// Dataset et statistiques tels que les laisse process_tabular_dataset
+static Dataset *make_dataset(DatasetAnalyzer *analyzer) {
+    Dataset *dataset = dataset_create(SAMPLES, INPUTS, OUTPUTS);
+    if (!dataset) return NULL;
+    for (size_t j = 0; j < SAMPLES; j++) {
+        for (size_t i = 0; i < INPUTS; i++) dataset->inputs[j][i] = (float)rand() / RAND_MAX;
+        dataset->outputs[j][0] = (float)(j % 2);
+    }
+    dataset->num_samples = SAMPLES;
+    for (int i = 0; i < INPUTS; i++) {
+        analyzer->input_types[i] = i == 2 ? FIELD_BINARY : FIELD_NUMERIC;
+        analyzer->input_min[i] = -1.5f * i;
+        analyzer->input_max[i] = 10.0f + i / 3.0f;
+        analyzer->input_mean[i] = 4.25f + i;
+        analyzer->input_std[i] = 0.1f * (i + 1);
+    }
+    analyzer->output_types[0] = FIELD_CATEGORICAL;
+    analyzer->output_min[0] = 0.0f;
+    analyzer->output_max[0] = 1.0f;
+    return dataset;
+}
+
+static int same_dataset(const Dataset *a, const Dataset *b) {
+    if (a->num_samples != b->num_samples || a->input_cols != b->input_cols || a->output_cols != b->output_cols)
+        return 0;
+    for (size_t j = 0; j < a->num_samples; j++)
+        if (memcmp(a->inputs[j], b->inputs[j], a->input_cols * sizeof(float)) != 0 ||
+            memcmp(a->outputs[j], b->outputs[j], a->output_cols * sizeof(float)) != 0)
+            return 0;
+    return 1;
+}
+
+static int same_stats(const DatasetAnalyzer *a, const DatasetAnalyzer *b) {
+    size_t in = a->num_input_fields * sizeof(float), out = a->num_output_fields * sizeof(float);
+    return memcmp(a->input_types, b->input_types, a->num_input_fields * sizeof(FieldType)) == 0 &&
+           memcmp(a->input_min, b->input_min, in) == 0 && memcmp(a->input_max, b->input_max, in) == 0 &&
+           memcmp(a->input_mean, b->input_mean, in) == 0 && memcmp(a->input_std, b->input_std, in) == 0 &&
+           memcmp(a->output_types, b->output_types, a->num_output_fields * sizeof(FieldType)) == 0 &&
+           memcmp(a->output_min, b->output_min, out) == 0 && memcmp(a->output_max, b->output_max, out) == 0 &&
+           b->num_samples == SAMPLES;
+}
+
+// La clé suit le contenu du CSV et les réglages de l'analyse, rien d'autre
+static int check_key(RichConfig *config, const DatasetAnalyzer *analyzer, uint64_t *key) {
+    uint64_t again, other;
+    int ok = 1;
+    ok &= test_check(dataset_cache_key(config, analyzer, key) && dataset_cache_key(config, analyzer, &again) &&
+                     *key == again, "clé stable pour le même CSV et les mêmes réglages");
+
+    config->auto_normalize = 0;
+    ok &= test_check(dataset_cache_key(config, analyzer, &other) && other != *key,
+                     "auto_normalize différent : autre clé");
+    config->auto_normalize = 1;
+
+    DatasetAnalyzer swapped = *analyzer;
+    strcpy(swapped.input_fields[0], "bmi");
+    strcpy(swapped.input_fields[1], "age");
+    ok &= test_check(dataset_cache_key(config, &swapped, &other) && other != *key,
+                     "autre ordre des champs d'entrée : autre clé");
+
+    char saved[sizeof(config->dataset)];
+    strcpy(saved, config->dataset);
+    strcpy(config->dataset, "/nonexistent/test_dataset_cache.csv");
+    ok &= test_check(!dataset_cache_key(config, analyzer, &other), "CSV illisible : pas de clé");
+    strcpy(config->dataset, saved);
+    return ok;
+}
+
+// Écriture puis relecture : mêmes lignes, mêmes types et statistiques
+static int check_round_trip(const char *path, uint64_t key, const DatasetAnalyzer *analyzer,
+                            const Dataset *dataset) {
+    int ok = test_check(dataset_cache_save(path, key, analyzer, dataset), "cache écrit");
+
+    DatasetAnalyzer loaded;
+    setup_analyzer(&loaded);
+    Dataset *reloaded = dataset_cache_load(path, key, &loaded);
+    ok &= test_check(reloaded && same_dataset(dataset, reloaded) && same_stats(analyzer, &loaded),
+                     "relecture : lignes, types et statistiques identiques");
+    if (reloaded) dataset_free(reloaded);
+    return ok;
+}
+
+static int load_fails(const char *path, uint64_t key) {
+    DatasetAnalyzer analyzer;
+    setup_analyzer(&analyzer);
+    Dataset *dataset = dataset_cache_load(path, key, &analyzer);
+    if (dataset) dataset_free(dataset);
+    return dataset == NULL;
+}
+
+// Recopier le cache valide en remplaçant size octets à offset ; seuls les keep
+// premiers octets sont écrits (keep < 0 : tout le fichier)
+static int write_variant(const char *from, const char *to, long offset, const void *bytes, size_t size,
+                         long keep) {
+    FILE *in = fopen(from, "rb");
+    if (!in) return 0;
+    fseek(in, 0, SEEK_END);
+    long length = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    unsigned char *data = malloc(length);
+    int ok = data && fread(data, 1, length, in) == (size_t)length;
+    fclose(in);
+    if (ok && bytes) memcpy(data + offset, bytes, size);
+    if (keep < 0 || keep > length) keep = length;
+    FILE *out = ok ? fopen(to, "wb") : NULL;
+    ok = out && fwrite(data, 1, keep, out) == (size_t)keep;
+    if (out && fclose(out) != 0) ok = 0;
+    free(data);
+    return ok;
+}
+
+// Clé périmée, en-tête invalide, fichier tronqué, colonnes différentes : cache refusé
+static int check_rejections(const char *path, const char *variant, uint64_t key) {
+    int ok = 1;
+    ok &= test_check(load_fails(path, key ^ 1), "clé périmée (CSV ou réglages modifiés) : refusé");
+
+    ok &= test_check(write_variant(path, variant, 0, "NPDSXXXX", 8, -1) && load_fails(variant, key),
+                     "mauvais magique : refusé");
+    uint32_t version = DATASET_CACHE_VERSION + 1;
+    ok &= test_check(write_variant(path, variant, offsetof(DatasetCacheHeader, version), &version, sizeof(version), -1) &&
+                     load_fails(variant, key), "autre version du format : refusé");
+    uint32_t header_size = sizeof(DatasetCacheHeader) + 8;
+    ok &= test_check(write_variant(path, variant, offsetof(DatasetCacheHeader, header_size), &header_size,
+                                   sizeof(header_size), -1) && load_fails(variant, key),
+                     "taille d'en-tête inattendue : refusé");
+    uint64_t samples = SAMPLES + 1;
+    ok &= test_check(write_variant(path, variant, offsetof(DatasetCacheHeader, num_samples), &samples, sizeof(samples), -1) &&
+                     load_fails(variant, key), "nombre d'échantillons incohérent avec la taille : refusé");
+    long full = (long)(sizeof(DatasetCacheHeader) + INPUTS * (sizeof(int32_t) + 4 * sizeof(float)) +
+                       OUTPUTS * (sizeof(int32_t) + 2 * sizeof(float)) + SAMPLES * (INPUTS + OUTPUTS) * sizeof(float));
+    ok &= test_check(write_variant(path, variant, 0, NULL, 0, full - (long)sizeof(float)) && load_fails(variant, key),
+                     "dernière ligne tronquée : refusé");
+    ok &= test_check(write_variant(path, variant, 0, NULL, 0, (long)sizeof(DatasetCacheHeader) - 4) &&
+                     load_fails(variant, key), "en-tête incomplet : refusé");
+
+    DatasetAnalyzer fewer;
+    setup_analyzer(&fewer);
+    fewer.num_input_fields = INPUTS - 1;
+    Dataset *dataset = dataset_cache_load(path, key, &fewer);
+    ok &= test_check(dataset == NULL, "autre nombre de colonnes d'entrée : refusé");
+    if (dataset) dataset_free(dataset);
+
+    ok &= test_check(load_fails("/nonexistent/test_dataset_cache.npcache", key), "cache absent : NULL");
+    return ok;
+}
+
+int main(void) {
+    srand(42);
+    char csv[256], path[512], variant[560];
+    snprintf(csv, sizeof(csv), "/tmp/test_dataset_cache_%d.csv", (int)getpid());
+    dataset_cache_path(csv, path, sizeof(path));
+    snprintf(variant, sizeof(variant), "%s.variant", path);
+    if (!write_text(csv, "age,bmi,smoker,outcome\n52,31.2,1,1\n37,22.8,0,0\n")) {
+        printf("Erreur: écriture du CSV de test %s impossible\n", csv);
+        return 1;
+    }
+
+    RichConfig config;
+    memset(&config, 0, sizeof(config));
+    strcpy(config.dataset, csv);
+    strcpy(config.field_detection, "auto");
+    config.auto_normalize = 1;
+    config.auto_categorize = 1;
+    DatasetAnalyzer analyzer;
+    setup_analyzer(&analyzer);
+    Dataset *dataset = make_dataset(&analyzer);
+    if (!dataset) {
+        printf("Erreur: allocation du dataset de test impossible\n");
+        return 1;
+    }
+
+    int ok = 1;
+    uint64_t key = 0;
+    printf("🧪 Cache des datasets : clé\n");
+    ok &= check_key(&config, &analyzer, &key);
+    printf("🧪 Cache des datasets : écriture et relecture\n");
+    ok &= check_round_trip(path, key, &analyzer, dataset);
+    printf("🧪 Cache des datasets : caches refusés\n");
+    ok &= check_rejections(path, variant, key);
+
+    uint64_t changed;
+    write_text(csv, "age,bmi,smoker,outcome\n52,31.2,1,1\n37,22.8,0,1\n");
+    ok &= test_check(dataset_cache_key(&config, &analyzer, &changed) && changed != key && load_fails(path, changed),
+                     "CSV modifié : nouvelle clé, ancien cache refusé");
+
+    dataset_free(dataset);
+    remove(csv);
+    remove(path);
+    remove(variant);
+    printf(ok ? "✅ Tous les tests du cache des datasets réussis\n" : "❌ Échec des tests du cache des datasets\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "src/optimizers/fused_update.h"
+#include "src/optimizers/adam.h"
+#include "src/optimizers/adamw.h"
+#include "src/optimizers/nadam.h"
+#include "src/optimizers/radam.h"
+
+#define STEPS 110          // Passe le warmup raccourci et l'ajustement de beta2 à t = 100
+#define LR 0.01f
+#define BETA1 0.9f
+#define BETA2 0.999f
+#define EPSILON 1e-8f
+#define TOLERANCE 1e-4f
+
+// État de référence : formules par élément d'origine (powf(beta, t) à chaque pas)
+typedef struct {
+    float *w, *m, *v;
+    float beta2;
+    int t;
+    int rectified_from;    // Premier pas rectifié (RAdam, Adam) ; 0 : jamais
+} Reference;
+
+static void reference_adam(Reference *r, const float *grad, size_t n, int warmup_steps) {
+    r->t++;
+    float grad_norm = 0.0f;
+    for (size_t i = 0; i < n; i++) grad_norm += grad[i] * grad[i];
+    grad_norm = sqrtf(grad_norm);
+    float clip_factor = grad_norm > 5.0f ? 5.0f / grad_norm : 1.0f;
+
+    float adaptive_lr = r->t <= warmup_steps ? LR * (float)r->t / warmup_steps
+                                             : LR * powf(0.9999f, r->t - warmup_steps);
+    adaptive_lr = fminf(fmaxf(adaptive_lr, LR * 0.01f), LR * 2.0f);
+
+    float b1 = BETA1, b2 = r->beta2;
+    float b1t = powf(b1, r->t), b2t = powf(b2, r->t);
+    float rho_inf = 2.0f / (1.0f - b2) - 1.0f;
+    float rho_t = rho_inf - 2.0f * r->t * b2t / (1.0f - b2t);
+    if (rho_t > 4.0f && !r->rectified_from) r->rectified_from = r->t;
+
+    for (size_t i = 0; i < n; i++) {
+        float g = grad[i] * clip_factor;
+        r->m[i] = b1 * r->m[i] + (1.0f - b1) * g;
+        r->v[i] = b2 * r->v[i] + (1.0f - b2) * g * g;
+        float m_hat = r->m[i] / (1.0f - b1t);
+        float update;
+        if (rho_t > 4.0f) {
+            float v_hat = r->v[i] / (1.0f - b2t);
+            float rect = sqrtf((rho_t - 4.0f) * (rho_t - 2.0f) * rho_inf /
+                               ((rho_inf - 4.0f) * (rho_inf - 2.0f) * rho_t));
+            update = adaptive_lr * rect * m_hat / (sqrtf(v_hat) + EPSILON);
+        } else {
+            update = adaptive_lr * m_hat;
+        }
+        if (fabsf(update) > 1.0f) update = copysignf(1.0f, update);
+        r->w[i] = fmaxf(-10.0f, fminf(10.0f, r->w[i] - update));
+    }
+
+    if (r->t % 100 == 0) {
+        if (grad_norm > 1.0f) r->beta2 = fminf(0.999f, r->beta2 + 0.001f);
+        else if (grad_norm < 0.1f) r->beta2 = fmaxf(0.9f, r->beta2 - 0.001f);
+    }
+}
+
+static void reference_adamw(Reference *r, const float *grad, size_t n, float weight_decay) {
+    r->t++;
+    float b1t = powf(BETA1, r->t), b2t = powf(BETA2, r->t);
+    for (size_t i = 0; i < n; i++) {
+        r->m[i] = BETA1 * r->m[i] + (1.0f - BETA1) * grad[i];
+        r->v[i] = BETA2 * r->v[i] + (1.0f - BETA2) * grad[i] * grad[i];
+        float m_hat = r->m[i] / (1.0f - b1t);
+        float v_hat = r->v[i] / (1.0f - b2t);
+        r->w[i] -= LR * (m_hat / (sqrtf(v_hat) + EPSILON) + weight_decay * r->w[i]);
+    }
+}
+
+static void reference_nadam(Reference *r, const float *grad, size_t n) {
+    r->t++;
+    float b1t = powf(BETA1, r->t), b2t = powf(BETA2, r->t);
+    for (size_t i = 0; i < n; i++) {
+        r->m[i] = BETA1 * r->m[i] + (1.0f - BETA1) * grad[i];
+        r->v[i] = BETA2 * r->v[i] + (1.0f - BETA2) * grad[i] * grad[i];
+        float m_hat = r->m[i] / (1.0f - b1t);
+        float v_hat = r->v[i] / (1.0f - b2t);
+        float m_nesterov = BETA1 * m_hat + (1.0f - BETA1) * grad[i] / (1.0f - b1t);
+        r->w[i] -= LR * m_nesterov / (sqrtf(v_hat) + EPSILON);
+    }
+}
+
+static void reference_radam(Reference *r, const float *grad, size_t n) {
+    r->t++;
+    float b1t = powf(BETA1, r->t), b2t = powf(BETA2, r->t);
+    float rho_inf = 2.0f / (1.0f - BETA2) - 1.0f;
+    float rho_t = rho_inf - 2.0f * r->t * b2t / (1.0f - b2t);
+    if (rho_t > 4.0f && !r->rectified_from) r->rectified_from = r->t;
+    for (size_t i = 0; i < n; i++) {
+        r->m[i] = BETA1 * r->m[i] + (1.0f - BETA1) * grad[i];
+        r->v[i] = BETA2 * r->v[i] + (1.0f - BETA2) * grad[i] * grad[i];
+        float m_hat = r->m[i] / (1.0f - b1t);
+        if (rho_t > 4.0f) {
+            float v_hat = r->v[i] / (1.0f - b2t);
+            float rect = sqrtf(((rho_t - 4) * (rho_t - 2) * rho_inf) / ((rho_inf - 4) * (rho_inf - 2) * rho_t));
+            r->w[i] -= LR * rect * m_hat / (sqrtf(v_hat) + EPSILON);
+        } else {
+            r->w[i] -= LR * m_hat;
+        }
+    }
+}
+
+static float max_rel_error(const float *x, const float *y, size_t n) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        float d = fabsf(x[i] - y[i]) / (fabsf(y[i]) + 1.0f);
+        if (!(d <= worst)) worst = d;   // NaN compte comme une erreur maximale
+    }
+    return worst;
+}
+
+typedef enum { RULE_ADAM, RULE_ADAMW, RULE_NADAM, RULE_RADAM } Rule;
+static const char *rule_names[] = { "adam", "adamw", "nadam", "radam" };
+
+// STEPS pas de l'optimiseur (noyau fusionné) et de la référence sur les mêmes gradients,
+// puis comparaison des poids et des deux moments
+static int check_rule(Rule rule, size_t n) {
+    float *w = malloc(n * sizeof(float));
+    float *grad = malloc(n * sizeof(float));
+    Reference ref = { malloc(n * sizeof(float)), calloc(n, sizeof(float)), calloc(n, sizeof(float)), BETA2, 0, 0 };
+    for (size_t i = 0; i < n; i++) w[i] = ref.w[i] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+
+    AdamState *adam = NULL;
+    AdamWState *adamw = NULL;
+    NadamState *nadam = NULL;
+    RAdamState *radam = NULL;
+    const float *m = NULL, *v = NULL;
+    int warmup_steps = 20;
+    switch (rule) {
+        case RULE_ADAM:
+            adam = adam_init(n, LR, BETA1, BETA2, EPSILON);
+            adam->warmup_steps = warmup_steps;
+            m = adam->m; v = adam->v;
+            break;
+        case RULE_ADAMW: adamw = adamw_init(n, LR, BETA1, BETA2, EPSILON, 0.01f); m = adamw->m; v = adamw->v; break;
+        case RULE_NADAM: nadam = nadam_init(n, LR, BETA1, BETA2, EPSILON); m = nadam->m; v = nadam->v; break;
+        case RULE_RADAM: radam = radam_init(n, LR, BETA1, BETA2, EPSILON); m = radam->m; v = radam->v; break;
+    }
+
+    for (int t = 0; t < STEPS; t++) {
+        // Gradients plus forts au début : le clipping d'Adam travaille sur les premiers pas
+        float scale = t < 10 ? 4.0f : 1.0f;
+        for (size_t i = 0; i < n; i++) grad[i] = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * scale;
+        switch (rule) {
+            case RULE_ADAM:  adam_update(adam, w, grad);  reference_adam(&ref, grad, n, warmup_steps); break;
+            case RULE_ADAMW: adamw_update(adamw, w, grad); reference_adamw(&ref, grad, n, 0.01f); break;
+            case RULE_NADAM: nadam_update(nadam, w, grad); reference_nadam(&ref, grad, n); break;
+            case RULE_RADAM: radam_update(radam, w, grad); reference_radam(&ref, grad, n); break;
+        }
+    }
+
+    float err_w = max_rel_error(w, ref.w, n);
+    float err_m = max_rel_error(m, ref.m, n);
+    float err_v = max_rel_error(v, ref.v, n);
+    float err = fmaxf(err_w, fmaxf(err_m, err_v));
+    // Adam et RAdam : β2 = 0,999 donne rho_t > 4 à partir du pas 5 (momentum seul avant)
+    int switch_ok = (rule != RULE_ADAM && rule != RULE_RADAM) || ref.rectified_from == 5;
+    int ok = err < TOLERANCE && switch_ok;
+    printf("   %s %-5s n=%6zu  erreur w=%.2e m=%.2e v=%.2e%s\n", ok ? "✅" : "❌", rule_names[rule], n,
+           err_w, err_m, err_v, switch_ok ? "" : "  (bascule de rectification inattendue)");
+
+    if (adam) adam_free(adam);
+    if (adamw) adamw_free(adamw);
+    if (nadam) nadam_free(nadam);
+    if (radam) radam_free(radam);
+    free(w);
+    free(grad);
+    free(ref.w);
+    free(ref.m);
+    free(ref.v);
+    return ok;
+}
+
+// Test du pas fusionné : chaque noyau comparé aux formules par élément d'origine
+int main(void) {
+    printf("🧪 TEST DU PAS FUSIONNÉ (ADAM, ADAMW, NADAM, RADAM)\n");
+    printf("===================================================\n\n");
+    srand(42);
+
+    // Longueurs hors multiples de 8 et 16 (queues scalaires), et une au-delà du seuil parallèle
+    const size_t lengths[] = { 1, 7, 13, 37, 100, 1029, 70001 };
+    const char *isas[] = { "avx512", "avx2", "scalar" };
+    size_t num_lengths = sizeof(lengths) / sizeof(lengths[0]);
+    int failures = 0;
+
+    for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); k++) {
+        if (!fused_update_force_isa(isas[k])) {
+            printf("⏭️  Noyau %s non disponible sur ce CPU\n\n", isas[k]);
+            continue;
+        }
+        printf("🔧 Noyau : %s\n", fused_update_isa());
+        for (size_t l = 0; l < num_lengths; l++)
+            for (int rule = RULE_ADAM; rule <= RULE_RADAM; rule++)
+                failures += !check_rule((Rule)rule, lengths[l]);
+        printf("\n");
+    }
+    fused_update_force_isa(NULL);
+
+    printf("%s %d échec(s)\n", failures ? "❌" : "✅", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "src/gemm.h"
+#include "src/matrix.h"
+
+// Produit de référence (triple boucle naïve, accumulation en double)
+static void reference_gemm(const Matrix *a, const Matrix *b, float alpha, float beta, Matrix *c) {
+    for (size_t i = 0; i < c->rows; i++)
+        for (size_t j = 0; j < c->cols; j++) {
+            double sum = 0.0;
+            for (size_t p = 0; p < a->cols; p++)
+                sum += (double)MATRIX_AT(a, i, p) * MATRIX_AT(b, p, j);
+            MATRIX_AT(c, i, j) = (float)(alpha * sum + beta * MATRIX_AT(c, i, j));
+        }
+}
+
+static float max_rel_error(const Matrix *x, const Matrix *y) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < x->rows; i++)
+        for (size_t j = 0; j < x->cols; j++) {
+            float d = fabsf(MATRIX_AT(x, i, j) - MATRIX_AT(y, i, j));
+            float s = fabsf(MATRIX_AT(y, i, j)) + 1.0f;
+            if (d / s > worst) worst = d / s;
+        }
+    return worst;
+}
+
+// Vérifie C = alpha*A*B + beta*C sur une forme donnée, A éventuellement transposée
+static int check_shape(size_t m, size_t n, size_t k, int transpose_a, float alpha, float beta) {
+    Matrix *a_store = transpose_a ? matrix_create(k, m) : matrix_create(m, k);
+    Matrix *b = matrix_create(k, n);
+    Matrix *c = matrix_create(m, n);
+    Matrix *ref = matrix_create(m, n);
+    matrix_randomize(a_store, -1.0f, 1.0f);
+    matrix_randomize(b, -1.0f, 1.0f);
+    matrix_randomize(c, -1.0f, 1.0f);
+    for (size_t i = 0; i < m; i++)
+        for (size_t j = 0; j < n; j++)
+            MATRIX_AT(ref, i, j) = MATRIX_AT(c, i, j);
+
+    Matrix a = transpose_a ? matrix_view_transpose(a_store) : *a_store;
+    matrix_gemm(alpha, &a, b, beta, c);
+    reference_gemm(&a, b, alpha, beta, ref);
+
+    float err = max_rel_error(c, ref);
+    int ok = err < 1e-4f;
+    printf("   %s %4zux%4zux%4zu %s alpha=%.1f beta=%.1f  erreur=%.2e\n",
+           ok ? "✅" : "❌", m, n, k, transpose_a ? "A^T" : "A  ", alpha, beta, err);
+
+    matrix_free(a_store);
+    matrix_free(b);
+    matrix_free(c);
+    matrix_free(ref);
+    return ok;
+}
+
+static double benchmark(size_t m, size_t n, size_t k) {
+    Matrix *a = matrix_create(m, k);
+    Matrix *b = matrix_create(k, n);
+    Matrix *c = matrix_create(m, n);
+    matrix_randomize(a, -1.0f, 1.0f);
+    matrix_randomize(b, -1.0f, 1.0f);
+
+    int reps = 5;
+    clock_t start = clock();
+    for (int r = 0; r < reps; r++)
+        matrix_dot_into(a, b, c);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    matrix_free(a);
+    matrix_free(b);
+    matrix_free(c);
+    return 2.0 * m * n * k * reps / seconds / 1e9;
+}
+
+// Test du produit matriciel : exactitude de chaque noyau et débit
+int main(void) {
+    printf("🧪 TEST DU PRODUIT MATRICIEL (GEMM)\n");
+    printf("===================================\n\n");
+    srand(42);
+
+    const size_t shapes[][3] = {
+        {1, 1, 1}, {3, 5, 7}, {6, 16, 8}, {17, 33, 9}, {64, 64, 64},
+        {100, 129, 257}, {32, 512, 1024}, {257, 65, 300}, {7, 2100, 20}
+    };
+    size_t num_shapes = sizeof(shapes) / sizeof(shapes[0]);
+    int failures = 0;
+
+    for (int pass = 0; pass < 2; pass++) {
+        gemm_force_scalar(pass == 1);
+        printf("🔧 Noyau : %s\n", gemm_kernel_name());
+        for (size_t s = 0; s < num_shapes; s++) {
+            failures += !check_shape(shapes[s][0], shapes[s][1], shapes[s][2], 0, 1.0f, 0.0f);
+            failures += !check_shape(shapes[s][0], shapes[s][1], shapes[s][2], 1, 0.5f, 1.0f);
+        }
+        printf("\n");
+    }
+
+    printf("⚡ Débit (32 x 1024 x 512, forme d'un lot de 32 sur la couche 1024->512)\n");
+    gemm_force_scalar(1);
+    printf("   scalar : %.2f GFLOP/s\n", benchmark(32, 512, 1024));
+    gemm_force_scalar(0);
+    printf("   %-6s : %.2f GFLOP/s\n", gemm_kernel_name(), benchmark(32, 512, 1024));
+
+    printf("\n%s %d échec(s)\n", failures ? "❌" : "✅", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
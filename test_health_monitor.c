@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "src/training/health_monitor.h"
+#include "test_common.h"
+
+#define PROBES 16
+#define INPUTS 4
+
+static float probe_rows[PROBES][INPUTS];
+static float *probe_inputs[PROBES];
+
+// Mêmes seuils que les valeurs par défaut du YAML, réduits pour des tests courts
+static RichConfig health_config(void) {
+    RichConfig config;
+    memset(&config, 0, sizeof(config));
+    config.health_monitor = 1;
+    config.health_warmup_epochs = 5;
+    config.health_check_interval = 5;
+    config.health_saturation_range = 0.001f;
+    config.health_saturation_checks = 3;
+    config.health_dead_fraction = 0.95f;
+    config.health_plateau_epochs = 8;
+    config.health_plateau_tolerance = 0.001f;
+    return config;
+}
+
+static NeuralNetwork *create_network(void) {
+    size_t sizes[] = { INPUTS, 8, 1 };
+    const char *activations[] = { "relu", "sigmoid" };
+    return network_create_simple_seeded(3, sizes, activations, 42);
+}
+
+// Loss en baisse régulière (1 % par époque) : jamais de verdict
+static int healthy_epochs(HealthMonitor *monitor, int epochs) {
+    float loss = 1.0f;
+    for (int epoch = 0; epoch < epochs; epoch++, loss *= 0.99f) {
+        if (health_monitor_epoch(monitor, epoch, loss) != HEALTH_OK) return 0;
+        if (health_monitor_scores(monitor, epoch, 0.1f, 0.9f, 0) != HEALTH_OK) return 0;
+    }
+    return 1;
+}
+
+// Divergence : loss, poids ou scores non finis, verdict immédiat même en préchauffage
+static int check_divergence(const RichConfig *config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    int ok = 1;
+
+    health_monitor_init(&monitor, config, net, probe_inputs, PROBES);
+    ok &= test_check(healthy_epochs(&monitor, 30), "loss en baisse, scores étalés : sain sur 30 époques");
+    ok &= test_check(health_monitor_epoch(&monitor, 30, NAN) == HEALTH_NONFINITE && monitor.status_epoch == 30,
+                     "loss NaN : nan_inf à l'époque 30");
+    ok &= test_check(health_monitor_epoch(&monitor, 31, 0.5f) == HEALTH_NONFINITE && monitor.status_epoch == 30,
+                     "verdict conservé aux époques suivantes");
+    ok &= test_check(health_status_restartable(HEALTH_NONFINITE), "nan_inf justifie un redémarrage");
+
+    health_monitor_restart(&monitor, net);
+    float saved = net->arena->params[3];
+    net->arena->params[3] = INFINITY;
+    ok &= test_check(health_monitor_epoch(&monitor, 1, 0.5f) == HEALTH_NONFINITE,
+                     "poids infini, loss finie : nan_inf avant la fin du préchauffage");
+    net->arena->params[3] = saved;
+
+    health_monitor_restart(&monitor, net);
+    ok &= test_check(health_monitor_scores(&monitor, 2, 0.1f, 0.9f, 3) == HEALTH_NONFINITE,
+                     "scores non finis : nan_inf");
+    health_monitor_free(&monitor);
+    return ok;
+}
+
+// Saturation : health_saturation_checks évaluations quasi constantes consécutives
+static int check_saturation(const RichConfig *config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    int ok = 1;
+
+    health_monitor_init(&monitor, config, net, probe_inputs, PROBES);
+    int early = 1;
+    for (int epoch = 0; epoch < 5; epoch++)
+        early &= health_monitor_scores(&monitor, epoch, 0.5f, 0.5002f, 0) == HEALTH_OK;
+    ok &= test_check(early, "sorties saturées pendant le préchauffage : pas de verdict");
+    ok &= test_check(health_monitor_scores(&monitor, 5, 0.5f, 0.5002f, 0) == HEALTH_SATURATED,
+                     "saturation toujours là après le préchauffage : sature");
+
+    health_monitor_restart(&monitor, net);
+    int reset = 1;
+    for (int epoch = 10; epoch < 30; epoch++) {
+        // Deux évaluations saturées sur trois : le compteur repart à chaque évaluation étalée
+        float range = epoch % 3 == 2 ? 0.5f : 0.0f;
+        reset &= health_monitor_scores(&monitor, epoch, 0.2f, 0.2f + range, 0) == HEALTH_OK;
+    }
+    ok &= test_check(reset, "saturation intermittente : compteur remis à zéro, sain");
+    health_monitor_scores(&monitor, 30, 0.2f, 0.2f, 0);
+    health_monitor_scores(&monitor, 31, 0.2f, 0.2f, 0);
+    ok &= test_check(health_monitor_scores(&monitor, 32, 0.2f, 0.2f, 0) == HEALTH_SATURATED &&
+                     monitor.status_epoch == 32,
+                     "troisième évaluation saturée consécutive : sature à l'époque 32");
+    ok &= test_check(health_status_restartable(HEALTH_SATURATED), "sature justifie un redémarrage");
+    health_monitor_free(&monitor);
+    return ok;
+}
+
+// Loss immobile : pas de baisse relative > tolérance sur health_plateau_epochs
+static int check_stall(const RichConfig *config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    int ok = 1;
+
+    health_monitor_init(&monitor, config, net, probe_inputs, PROBES);
+    HealthStatus status = HEALTH_OK;
+    int epoch = 0;
+    float loss = 0.8f;
+    for (; epoch < 40 && status == HEALTH_OK; epoch++) {
+        // Baisse de 0,01 % par époque : sous la tolérance de 0,1 %
+        status = health_monitor_epoch(&monitor, epoch, loss);
+        loss *= 0.9999f;
+    }
+    ok &= test_check(status == HEALTH_PLATEAU && monitor.status_epoch == 8,
+                     "baisse sous la tolérance : plateau 8 époques après la meilleure loss");
+    ok &= test_check(!health_status_restartable(HEALTH_PLATEAU), "plateau : abandon, pas de redémarrage");
+
+    health_monitor_restart(&monitor, net);
+    status = HEALTH_OK;
+    for (epoch = 0; epoch < 20 && status == HEALTH_OK; epoch++) status = health_monitor_epoch(&monitor, epoch, 1.0f);
+    ok &= test_check(status == HEALTH_PLATEAU && monitor.status_epoch == 8,
+                     "loss constante : plateau à l'époque 8");
+
+    health_monitor_restart(&monitor, net);
+    ok &= test_check(healthy_epochs(&monitor, 60), "baisse de 1 % par époque : jamais de plateau");
+    health_monitor_free(&monitor);
+    return ok;
+}
+
+// Essai convergé dont la loss s'aplatit : fin normale de l'apprentissage, pas un plateau
+static int check_converged(const RichConfig *config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    int ok = 1;
+
+    health_monitor_init(&monitor, config, net, probe_inputs, PROBES);
+    ok &= test_check(healthy_epochs(&monitor, 10), "loss en baisse jusqu'à la convergence");
+    ok &= test_check(health_monitor_converged(&monitor) == HEALTH_OK, "convergence à l'époque 10");
+    int flat = 1;
+    for (int epoch = 10; epoch < 60; epoch++) flat &= health_monitor_epoch(&monitor, epoch, 0.9f) == HEALTH_OK;
+    ok &= test_check(flat, "loss constante 50 époques après la convergence : toujours sain");
+    ok &= test_check(health_monitor_epoch(&monitor, 60, NAN) == HEALTH_NONFINITE,
+                     "après la convergence, nan_inf reste détecté");
+
+    // Plateau constaté à l'époque même de la convergence (ou de l'early stopping) : levé
+    health_monitor_restart(&monitor, net);
+    HealthStatus status = HEALTH_OK;
+    for (int epoch = 0; epoch < 20 && status == HEALTH_OK; epoch++) status = health_monitor_epoch(&monitor, epoch, 1.0f);
+    ok &= test_check(status == HEALTH_PLATEAU && health_monitor_converged(&monitor) == HEALTH_OK &&
+                     monitor.status_epoch == -1, "plateau à l'époque de la convergence : levé");
+    ok &= test_check(health_monitor_epoch(&monitor, 20, 1.0f) == HEALTH_OK, "puis plus de verdict plateau");
+
+    health_monitor_restart(&monitor, net);
+    status = HEALTH_OK;
+    for (int epoch = 0; epoch < 20 && status == HEALTH_OK; epoch++) status = health_monitor_epoch(&monitor, epoch, 1.0f);
+    ok &= test_check(status == HEALTH_PLATEAU, "redémarrage : l'essai n'est plus considéré convergé");
+    health_monitor_free(&monitor);
+    return ok;
+}
+
+// Couche cachée ReLU effondrée : tous les poids à zéro, sorties cachées nulles
+static int check_dead_units(const RichConfig *config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    int ok = 1;
+
+    health_monitor_init(&monitor, config, net, probe_inputs, PROBES);
+    ok &= test_check(healthy_epochs(&monitor, 12), "réseau initialisé : unités cachées vivantes");
+
+    float *saved = malloc(net->arena->size * sizeof(float));
+    memcpy(saved, net->arena->params, net->arena->size * sizeof(float));
+    memset(net->arena->params, 0, net->arena->size * sizeof(float));
+    ok &= test_check(health_monitor_epoch(&monitor, 13, 0.5f) == HEALTH_OK,
+                     "hors intervalle de sondage : pas de verdict");
+    ok &= test_check(health_monitor_epoch(&monitor, 15, 0.5f) == HEALTH_DEAD_UNITS,
+                     "poids nuls, sondage à l'époque 15 : unites_mortes");
+    memcpy(net->arena->params, saved, net->arena->size * sizeof(float));
+    free(saved);
+    health_monitor_free(&monitor);
+    return ok;
+}
+
+static int check_disabled(RichConfig config, NeuralNetwork *net) {
+    HealthMonitor monitor;
+    config.health_monitor = 0;
+    health_monitor_init(&monitor, &config, net, probe_inputs, PROBES);
+    int ok = health_monitor_epoch(&monitor, 20, NAN) == HEALTH_OK &&
+             health_monitor_scores(&monitor, 20, 0.5f, 0.5f, 7) == HEALTH_OK;
+    health_monitor_free(&monitor);
+    return test_check(ok, "surveillance désactivée : toujours sain");
+}
+
+int main(void) {
+    srand(42);
+    for (int i = 0; i < PROBES; i++) {
+        for (int j = 0; j < INPUTS; j++) probe_rows[i][j] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        probe_inputs[i] = probe_rows[i];
+    }
+    RichConfig config = health_config();
+    NeuralNetwork *net = create_network();
+    if (!net) {
+        printf("Erreur: création du réseau de test impossible\n");
+        return 1;
+    }
+
+    int ok = 1;
+    printf("🧪 Surveillance de santé : divergence\n");
+    ok &= check_divergence(&config, net);
+    printf("🧪 Surveillance de santé : saturation\n");
+    ok &= check_saturation(&config, net);
+    printf("🧪 Surveillance de santé : loss immobile\n");
+    ok &= check_stall(&config, net);
+    printf("🧪 Surveillance de santé : loss immobile après la convergence\n");
+    ok &= check_converged(&config, net);
+    printf("🧪 Surveillance de santé : unités mortes, désactivation\n");
+    ok &= check_dead_units(&config, net);
+    ok &= check_disabled(config, net);
+
+    network_free_simple(net);
+    printf(ok ? "✅ Tous les tests de surveillance de santé réussis\n" : "❌ Échec des tests de surveillance de santé\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "src/evaluation/metrics_engine.h"
+#include "src/evaluation/roc.h"
+
+// Vérification de chaque seuil visité : comptage direct score > seuil
+typedef struct {
+    const float *scores, *labels;
+    size_t n, visited, errors;
+    float best_f1;
+} CheckCtx;
+
+static void check_threshold(void *ctx, const ThresholdMetrics *m) {
+    CheckCtx *c = ctx;
+    size_t tp = 0, fp = 0;
+    for (size_t i = 0; i < c->n; i++) {
+        if (c->scores[i] > m->threshold) {
+            if (c->labels[i] > 0.5f) tp++; else fp++;
+        }
+    }
+    if (tp != m->tp || fp != m->fp) c->errors++;
+    if (m->f1 > c->best_f1) c->best_f1 = m->f1;
+    c->visited++;
+}
+
+// AUC de référence : statistique de Mann-Whitney, O(P x N), ex aequo = 1/2
+static double reference_auc(const float *scores, const float *labels, size_t n) {
+    double wins = 0.0;
+    size_t p = 0, q = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (labels[i] <= 0.5f) continue;
+        p++;
+        for (size_t j = 0; j < n; j++) {
+            if (labels[j] > 0.5f) continue;
+            wins += scores[i] > scores[j] ? 1.0 : scores[i] == scores[j] ? 0.5 : 0.0;
+        }
+    }
+    q = n - p;
+    return (p && q) ? wins / ((double)p * q) : 0.5;
+}
+
+// Scores arrondis à `levels` valeurs (beaucoup d'ex aequo) ou continus
+static int check_case(MetricsWorkspace *ws, size_t n, int levels, float negative_share) {
+    metrics_workspace_reserve(ws, n);
+    for (size_t i = 0; i < n; i++) {
+        float label = (float)rand() / RAND_MAX > 0.3f ? 1.0f : 0.0f;
+        float score = 0.6f * label + (float)rand() / RAND_MAX - negative_share;
+        if (levels > 0) score = floorf(score * levels) / levels;
+        ws->scores[i] = score;
+        ws->labels[i] = label;
+    }
+
+    CheckCtx ctx = { ws->scores, ws->labels, n, 0, 0, 0.0f };
+    MetricsSummary summary;
+    metrics_sweep(ws, n, 0.25f, check_threshold, &ctx, &summary);
+    ctx.best_f1 = 0.0f;
+    // Le balayage ne modifie pas scores/labels : seconde passe de contrôle
+    metrics_sweep(ws, n, 0.25f, check_threshold, &ctx, &summary);
+
+    size_t tp_fixed = 0, fp_fixed = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (ws->scores[i] > 0.25f) {
+            if (ws->labels[i] > 0.5f) tp_fixed++; else fp_fixed++;
+        }
+    }
+
+    double auc_ref = reference_auc(ws->scores, ws->labels, n);
+    ThresholdMetrics fixed;
+    metrics_at_threshold(ws, n, 0.25f, &fixed);
+    float bound;
+    float auc_hist = compute_auc_histogram(ws->labels, ws->scores, n, &bound);
+    int ok = ctx.errors == 0 && summary.best_f1.f1 == ctx.best_f1 &&
+             summary.at_threshold.tp == tp_fixed && summary.at_threshold.fp == fp_fixed &&
+             fixed.tp == tp_fixed && fixed.fp == fp_fixed &&
+             fabs(summary.auc - auc_ref) < 1e-5 &&
+             fabs(compute_auc(ws->labels, ws->scores, (int)n) - auc_ref) < 1e-5 &&
+             fabs(auc_hist - auc_ref) <= bound + 1e-5;
+    printf("   %s n=%-6zu niveaux=%-4d seuils=%-6zu AUC=%.5f (réf %.5f, histogramme %.5f ± %.5f) F1*=%.3f @ %.4f\n",
+           ok ? "✅" : "❌", n, levels, ctx.visited / 2, summary.auc, auc_ref, auc_hist, bound,
+           summary.best_f1.f1, summary.best_f1.threshold);
+    return ok;
+}
+
+// Grille de 99 seuils (ancienne optimisation du seuil) face au balayage unique,
+// puis AUC exacte face à l'AUC par histogramme
+static void benchmark(MetricsWorkspace *ws) {
+    size_t n = 1 << 20;
+    metrics_workspace_reserve(ws, n);
+    float *scores = malloc(n * sizeof(float));
+    float *labels = malloc(n * sizeof(float));
+    for (size_t i = 0; i < n; i++) {
+        labels[i] = rand() & 1 ? 1.0f : 0.0f;
+        scores[i] = 0.3f * labels[i] + 0.7f * (float)rand() / RAND_MAX;
+    }
+
+    // Meilleur de 5 pour les deux méthodes ; un premier balayage hors chrono
+    // touche l'espace de travail, réutilisé d'une époque à l'autre à l'entraînement
+    MetricsSummary summary;
+    memcpy(ws->scores, scores, n * sizeof(float));
+    memcpy(ws->labels, labels, n * sizeof(float));
+    metrics_sweep(ws, n, 0.5f, NULL, NULL, &summary);
+
+    double grid_s = 1e9, sweep_s = 1e9;
+    volatile size_t sink = 0;
+    for (int run = 0; run < 5; run++) {
+        clock_t start = clock();
+        for (float t = 0.01f; t <= 0.99f; t += 0.01f) {
+            size_t tp = 0, fp = 0;
+            for (size_t i = 0; i < n; i++) {
+                int predicted = scores[i] > t;
+                tp += predicted & (labels[i] > 0.5f);
+                fp += predicted & (labels[i] <= 0.5f);
+            }
+            sink += tp + fp;
+        }
+        double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (elapsed < grid_s) grid_s = elapsed;
+
+        start = clock();
+        memcpy(ws->scores, scores, n * sizeof(float));
+        memcpy(ws->labels, labels, n * sizeof(float));
+        metrics_sweep(ws, n, 0.5f, NULL, NULL, &summary);
+        elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (elapsed < sweep_s) sweep_s = elapsed;
+    }
+    (void)sink;
+
+    clock_t start = clock();
+    float exact = compute_auc(labels, scores, (int)n);
+    double exact_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    float bound;
+    start = clock();
+    float approx = compute_auc_histogram(labels, scores, n, &bound);
+    double hist_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("   n=%zu : grille 99 seuils %.1f ms | balayage unique %.1f ms (x%.1f)\n",
+           n, grid_s * 1e3, sweep_s * 1e3, sweep_s > 0 ? grid_s / sweep_s : 0.0);
+    printf("   n=%zu : AUC exacte %.1f ms (%.6f) | histogramme %.1f ms (%.6f, borne %.1e)\n",
+           n, exact_s * 1e3, exact, hist_s * 1e3, approx, bound);
+    free(scores);
+    free(labels);
+}
+
+int main(void) {
+    srand(42);
+    MetricsWorkspace ws;
+    metrics_workspace_init(&ws);
+
+    int ok = 1;
+    printf("🧪 Balayage exact des seuils (comparaison au comptage direct)\n");
+    ok &= check_case(&ws, 1, 0, 0.0f);
+    ok &= check_case(&ws, 50, 4, 0.5f);
+    ok &= check_case(&ws, 1000, 0, 0.5f);
+    ok &= check_case(&ws, 3000, 20, 1.0f);
+    ok &= check_case(&ws, 5000, 0, 0.0f);
+
+    printf("⏱️  Débit\n");
+    benchmark(&ws);
+
+    metrics_workspace_free(&ws);
+    printf(ok ? "✅ Tous les tests du moteur de métriques réussis\n" : "❌ Échec des tests du moteur de métriques\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "src/neural/network_simple.h"
+#include "src/neural/activation.h"
+#include "test_common.h"
+
+#define SAMPLES 64
+#define INPUTS 12
+#define EPOCHS 3
+#define CLASS_WEIGHT_RATIO 3.0f
+
+static float input_rows[SAMPLES][INPUTS];
+static float target_rows[SAMPLES][1];
+
+// ============================================================================
+// RÉFÉRENCE : passe par échantillon d'origine
+// ============================================================================
+// Produit dense, erreur cachée sommée colonne par colonne de la matrice suivante,
+// mise à jour de toutes les lignes. Appliquée directement aux couches d'un second
+// réseau créé avec la même graine.
+
+static void reference_forward(NeuralNetwork *net, const float *input) {
+    const float *x = input;
+    for (size_t l = 0; l < net->num_layers; l++) {
+        Layer *layer = net->layers[l];
+        for (size_t j = 0; j < layer->output_size; j++) {
+            float sum = layer->biases[j];
+            for (size_t k = 0; k < layer->input_size; k++) sum += layer->weights[j][k] * x[k];
+            layer->outputs[j] = sum;
+        }
+        if (layer->derivatives) {
+            layer->kernels->forward_derivative(layer->outputs, layer->outputs, layer->derivatives,
+                                               layer->output_size);
+        } else {
+            layer->kernels->forward(layer->outputs, layer->outputs, layer->output_size);
+        }
+        x = layer->outputs;
+    }
+}
+
+static float reference_output_delta(float output, float target_val, activation_type_t activation) {
+    float error = target_val - output;
+    float weight = target_val > 0.5f ? CLASS_WEIGHT_RATIO : 1.0f;
+    if (target_val > 0.5f && output < 0.3f) {
+        weight *= 1.8f;
+    } else if (target_val < 0.5f && output > 0.7f) {
+        weight *= 1.5f;
+    } else if (fabsf(target_val - output) > 0.7f) {
+        weight *= 1.3f;
+    }
+    float derivative = activation_derivative_from_output(activation, output);
+    if (activation == ACTIVATION_SIGMOID) derivative = fmaxf(derivative, 0.01f);
+    return error * weight * derivative;
+}
+
+static void reference_backward(NeuralNetwork *net, const NetworkConfig *config, float *velocity,
+                               const float *input, const float *target) {
+    Layer *output_layer = net->layers[net->num_layers - 1];
+    for (size_t i = 0; i < output_layer->output_size; i++) {
+        output_layer->deltas[i] = reference_output_delta(output_layer->outputs[i], target[i],
+                                                         output_layer->activation_type);
+    }
+
+    for (int l = (int)net->num_layers - 2; l >= 0; l--) {
+        Layer *layer = net->layers[l];
+        Layer *next = net->layers[l + 1];
+        for (size_t i = 0; i < layer->output_size; i++) {
+            float error = 0.0f;
+            for (size_t j = 0; j < next->output_size; j++) error += next->deltas[j] * next->weights[j][i];
+            layer->deltas[i] = error;
+        }
+        if (layer->derivatives) {
+            for (size_t i = 0; i < layer->output_size; i++) layer->deltas[i] *= layer->derivatives[i];
+        } else {
+            layer->kernels->backward(layer->outputs, layer->deltas, layer->output_size);
+        }
+    }
+
+    const float *x = input;
+    for (size_t l = 0; l < net->num_layers; l++) {
+        Layer *layer = net->layers[l];
+        float delta_sq = 0.0f, input_sq = 0.0f;
+        for (size_t i = 0; i < layer->output_size; i++) delta_sq += layer->deltas[i] * layer->deltas[i];
+        for (size_t j = 0; j < layer->input_size; j++) input_sq += x[j] * x[j];
+        float norm = sqrtf(delta_sq * (input_sq + 1.0f));
+        float clip = norm > 10.0f ? 10.0f / norm : 1.0f;
+
+        for (size_t i = 0; i < layer->output_size; i++) {
+            float scaled_delta = layer->deltas[i] * clip;
+            float *w = layer->weights[i];
+            float *vel = velocity + layer->weight_offset + i * layer->input_size;
+            for (size_t j = 0; j < layer->input_size; j++) {
+                float gradient = scaled_delta * x[j] + config->l2_lambda * w[j];
+                if (config->use_momentum) {
+                    vel[j] = config->momentum * vel[j] + config->learning_rate * gradient;
+                    w[j] += vel[j];
+                } else {
+                    w[j] += config->learning_rate * gradient;
+                }
+            }
+            layer->biases[i] += config->learning_rate * scaled_delta;
+        }
+        x = layer->outputs;
+    }
+}
+
+// ============================================================================
+// COMPARAISON
+// ============================================================================
+
+static int same_outputs(const NeuralNetwork *a, const NeuralNetwork *b) {
+    for (size_t l = 0; l < a->num_layers; l++) {
+        if (memcmp(a->layers[l]->outputs, b->layers[l]->outputs, a->layers[l]->output_size * sizeof(float)) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+// Couches dont l'entrée compte au moins 20 % de zéros : passe avant sur les seules colonnes actives
+static int sparse_layers(const NeuralNetwork *net, const float *input) {
+    int count = 0;
+    const float *x = input;
+    for (size_t l = 0; l < net->num_layers; l++) {
+        size_t zeros = 0;
+        for (size_t k = 0; k < net->layers[l]->input_size; k++) zeros += x[k] == 0.0f;
+        count += (float)zeros >= 0.2f * (float)net->layers[l]->input_size;
+        x = net->layers[l]->outputs;
+    }
+    return count;
+}
+
+static int same_params(const NeuralNetwork *a, const NeuralNetwork *b) {
+    return a->arena->size == b->arena->size &&
+           memcmp(a->arena->params, b->arena->params, a->arena->size * sizeof(float)) == 0;
+}
+
+// EPOCHS passages sur le dataset fixe : network_forward/backward_simple d'un côté,
+// la référence de l'autre, sur deux réseaux de même graine. Sorties de chaque passe
+// avant et poids identiques au bit près.
+static int check_training(const char *what, const char **activations, int use_momentum, float l2_lambda) {
+    size_t sizes[] = { INPUTS, 32, 16, 1 };
+    NetworkConfig config = create_default_config();
+    config.learning_rate = 0.01f;
+    config.class_weight_ratio = CLASS_WEIGHT_RATIO;
+    config.use_dropout = 0;
+    config.use_momentum = use_momentum;
+    config.l2_lambda = l2_lambda;
+    config.seed = 1234;
+    NeuralNetwork *net = network_create_simple_configured(4, sizes, activations, config);
+    NeuralNetwork *ref = network_create_simple_configured(4, sizes, activations, config);
+    float *velocity = ref ? calloc(ref->arena->size, sizeof(float)) : NULL;
+    if (!net || !ref || !velocity) {
+        printf("Erreur: création des réseaux de test impossible\n");
+        if (net) network_free_simple(net);
+        if (ref) network_free_simple(ref);
+        free(velocity);
+        return 0;
+    }
+
+    int ok = same_params(net, ref), outputs_ok = 1, sparse = 0;
+    for (int epoch = 0; epoch < EPOCHS && ok; epoch++) {
+        for (size_t s = 0; s < SAMPLES; s++) {
+            network_forward_simple(net, input_rows[s]);
+            reference_forward(ref, input_rows[s]);
+            outputs_ok &= same_outputs(net, ref);
+            sparse += sparse_layers(net, input_rows[s]);
+            network_backward_simple(net, input_rows[s], target_rows[s], config.learning_rate);
+            reference_backward(ref, &config, velocity, input_rows[s], target_rows[s]);
+        }
+        ok = same_params(net, ref);
+    }
+
+    char label[200];
+    snprintf(label, sizeof(label), "%s : sorties et poids identiques après %d pas (%d passes de couche creuses)",
+             what, EPOCHS * SAMPLES, sparse);
+    ok &= outputs_ok;
+    network_free_simple(net);
+    network_free_simple(ref);
+    free(velocity);
+    return test_check(ok, label);
+}
+
+int main(void) {
+    srand(42);
+    for (size_t s = 0; s < SAMPLES; s++) {
+        float sum = 0.0f;
+        for (size_t k = 0; k < INPUTS; k++) {
+            // Un tiers d'entrées nulles : la première couche passe aussi par le produit creux
+            input_rows[s][k] = rand() % 3 == 0 ? 0.0f : (float)rand() / RAND_MAX * 2.0f - 1.0f;
+            sum += input_rows[s][k] * (k % 3 == 0 ? 1.0f : -0.5f);
+        }
+        target_rows[s][0] = sum > 0.0f ? 1.0f : 0.0f;
+    }
+
+    int ok = 1;
+    const char *gelu[] = { "gelu", "gelu", "sigmoid" };
+    const char *sigmoid[] = { "sigmoid", "sigmoid", "sigmoid" };
+    const char *relu[] = { "relu", "relu", "sigmoid" };
+    printf("🧪 Rétropropagation par échantillon : erreur cachée ligne par ligne contre somme par colonne\n");
+    ok &= check_training("gelu, momentum et L2", gelu, 1, 0.0005f);
+    ok &= check_training("sigmoid, SGD simple", sigmoid, 0, 0.0f);
+    printf("🧪 Unités ReLU inactives : colonnes et lignes sautées contre passe dense\n");
+    ok &= check_training("relu, momentum et L2", relu, 1, 0.0005f);
+    ok &= check_training("relu, SGD sans momentum ni L2 (lignes à delta nul sautées)", relu, 0, 0.0f);
+
+    printf(ok ? "✅ Tous les tests de la rétropropagation par échantillon réussis\n"
+              : "❌ Échec des tests de la rétropropagation par échantillon\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "src/sweep_journal.h"
+#include "test_common.h"
+
+#define CONFIG_A 0x1234abcd5678ef01ULL
+#define CONFIG_B 0x0fedcba987654321ULL
+
+static JournalTrial make_trial(const char *optimizer, int trial, uint64_t seed) {
+    JournalTrial t;
+    memset(&t, 0, sizeof(t));
+    strcpy(t.method, "standard");
+    strcpy(t.optimizer, optimizer);
+    strcpy(t.activation, "gelu");
+    t.trial = trial;
+    t.epochs = 40;
+    t.seed = seed;
+    t.converged = 1;
+    t.convergence_epoch = 17;
+    // Valeurs sans écriture décimale exacte : %.9g doit les relire à l'identique
+    t.final_loss = 0.1f / 3.0f;
+    t.lr = 3e-4f;
+    t.accuracy = 0.8712345f;
+    t.precision = 0.7f;
+    t.recall = 2.0f / 3.0f;
+    t.f1_score = 0.6871f;
+    t.auc_roc = 0.91f;
+    t.health = 2;
+    t.restarts = 1;
+    t.epochs_run = 23;
+    return t;
+}
+
+static int same_trial(const JournalTrial *a, const JournalTrial *b) {
+    return a->trial == b->trial && a->epochs == b->epochs && a->seed == b->seed &&
+           strcmp(a->method, b->method) == 0 && strcmp(a->optimizer, b->optimizer) == 0 &&
+           strcmp(a->activation, b->activation) == 0 &&
+           a->converged == b->converged && a->convergence_epoch == b->convergence_epoch &&
+           a->final_loss == b->final_loss && a->lr == b->lr && a->accuracy == b->accuracy &&
+           a->precision == b->precision && a->recall == b->recall &&
+           a->f1_score == b->f1_score && a->auc_roc == b->auc_roc &&
+           a->health == b->health && a->restarts == b->restarts && a->epochs_run == b->epochs_run;
+}
+
+static int find_same(SweepJournal *journal, const JournalTrial *t) {
+    const JournalTrial *found = sweep_journal_find(journal, t->method, t->optimizer, t->activation,
+                                                   t->trial, t->epochs, t->seed);
+    return found && same_trial(found, t);
+}
+
+// Écriture puis reprise : essais relus à l'identique, graine du balayage conservée
+static int check_round_trip(const char *path) {
+    SweepJournal journal;
+    JournalTrial adam = make_trial("adamw", 0, 111);
+    JournalTrial sgd = make_trial("sgd", 1, 222);
+    int ok = 1;
+
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 1001) &&
+                     journal.resumed == 0 && journal.base_seed == 1001,
+                     "nouveau journal : balayage déclaré avec la graine fournie");
+    ok &= test_check(sweep_journal_append(&journal, &adam) && sweep_journal_append(&journal, &sgd),
+                     "ajout de deux essais");
+    sweep_journal_close(&journal);
+
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 2002) &&
+                     journal.resumed == 2 && journal.base_seed == 1001,
+                     "reprise : 2 essais relus, graine d'origine reprise");
+    ok &= test_check(find_same(&journal, &adam) && find_same(&journal, &sgd),
+                     "essais relus champ par champ (flottants exacts)");
+    ok &= test_check(!sweep_journal_find(&journal, "standard", "adamw", "gelu", 0, 80, 111),
+                     "un autre palier d'époques n'est pas un essai terminé");
+    sweep_journal_close(&journal);
+    return ok;
+}
+
+// Arrêt brutal au milieu d'une ligne : la ligne est ignorée puis terminée,
+// l'essai suivant ne s'y colle pas
+static int check_truncated_line(const char *path) {
+    FILE *file = fopen(path, "a");
+    if (!file) return test_check(0, "ouverture du journal pour tronquer la dernière ligne");
+    fputs("T 1234abcd5678ef01 standard lion gelu 2 40 333 1 12 0.0", file);
+    fclose(file);
+
+    SweepJournal journal;
+    JournalTrial lion = make_trial("lion", 2, 333);
+    int ok = 1;
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 3003) &&
+                     journal.resumed == 2 && journal.base_seed == 1001 &&
+                     !sweep_journal_find(&journal, "standard", "lion", "gelu", 2, 40, 333),
+                     "ligne tronquée ignorée à la reprise");
+    ok &= test_check(sweep_journal_append(&journal, &lion), "ajout après la ligne tronquée");
+    sweep_journal_close(&journal);
+
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 4004) &&
+                     journal.resumed == 3 && find_same(&journal, &lion),
+                     "essai suivant relu intact (ligne tronquée terminée)");
+    sweep_journal_close(&journal);
+    return ok;
+}
+
+// Autre configuration : rien n'est repris, un nouveau balayage est déclaré ;
+// les essais de la première configuration restent lisibles et reprenables
+static int check_config_mismatch(const char *path) {
+    SweepJournal journal;
+    JournalTrial other = make_trial("adamw", 0, 111);
+    int ok = 1;
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_B, 1, 5005) &&
+                     journal.resumed == 0 && journal.base_seed == 5005 &&
+                     !sweep_journal_find(&journal, "standard", "adamw", "gelu", 0, 40, 111),
+                     "hash de configuration différent : aucun essai repris");
+    other.accuracy = 0.5f;
+    ok &= test_check(sweep_journal_append(&journal, &other), "ajout sous la seconde configuration");
+    sweep_journal_close(&journal);
+
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 6006) &&
+                     journal.resumed == 3 && journal.base_seed == 1001,
+                     "première configuration toujours reprise (3 essais)");
+    sweep_journal_close(&journal);
+
+    ok &= test_check(sweep_journal_load(&journal, path) && journal.count == 4 &&
+                     journal.config_hash == CONFIG_B && journal.base_seed == 5005,
+                     "lecture seule : 4 essais, toutes configurations");
+    sweep_journal_close(&journal);
+
+    // resume = 0 : nouveau balayage, les essais précédents ne sont plus repris
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 0, 7007) &&
+                     journal.resumed == 0 && journal.base_seed == 7007,
+                     "sans reprise : nouveau balayage déclaré");
+    sweep_journal_close(&journal);
+    ok &= test_check(sweep_journal_open(&journal, path, CONFIG_A, 1, 8008) &&
+                     journal.resumed == 0 && journal.base_seed == 7007,
+                     "reprise suivante : seul le dernier balayage compte");
+    sweep_journal_close(&journal);
+    return ok;
+}
+
+int main(void) {
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_sweep_journal_%d.log", (int)getpid());
+    remove(path);
+
+    int ok = 1;
+    printf("🧪 Journal du balayage : écriture, reprise, ligne tronquée, autre configuration\n");
+    ok &= check_round_trip(path);
+    ok &= check_truncated_line(path);
+    ok &= check_config_mismatch(path);
+
+    remove(path);
+    printf(ok ? "✅ Tous les tests du journal du balayage réussis\n" : "❌ Échec des tests du journal du balayage\n");
+    return ok ? 0 : 1;
+}